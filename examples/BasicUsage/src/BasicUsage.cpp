@@ -48,7 +48,7 @@ TouchSlider slider {pins, SENSOR_COUNT};
  * @param notUsed Unused parameter containing whever it was we passed when the change handler was registered
  *                in our case, it's nullptr.
  */
-void onChanged(int32_t value, void* notUsed) {
+void onChanged(tsl_value_t value, void* notUsed) {
   Serial.print(F("\r"));
   #ifdef TSL_DEBUG
   slider.printState();
@@ -0,0 +1,149 @@
+/****
+ * This file is a part of the TouchSlider Arduino library. See TouchSlider.h for details. It's for host (PC) builds 
+ * only, not for the Arduino.
+ * 
+ * A stand-in for the parts of Arduino.h that the TouchSlider library uses, so the library can be compiled and run 
+ * on a host for simulation, benchmarking and checking. Time comes from hostMicros, which the host program sets 
+ * (or use TouchSlider::setClock()); GPIO port registers are plain memory; Serial writes to a file, if given one. 
+ * Build with extras/host ahead of the Arduino headers on the include path and compile ArduinoHost.cpp along with 
+ * the library sources, e.g.,
+ * 
+ *      g++ -std=gnu++11 -Iextras/host -Isrc extras/sim/FingerScore.cpp extras/host/ArduinoHost.cpp \
+ *          src/TouchSlider.cpp src/TouchSliderGroup.cpp -o fingerscore
+ *****
+ * 
+ * TouchSlider V1.0.2, November 2025
+ * Copyright (C) 2025 D.L. Ehnebuske
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ * 
+ ****/
+#pragma once
+#define Arduino_h
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define NUM_DIGITAL_PINS 64
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+#define PROGMEM
+#define F(s) (s)
+
+typedef uint8_t byte;
+
+inline uint8_t pgm_read_byte(const void* p) {
+    return *static_cast<const uint8_t*>(p);
+}
+inline uint16_t pgm_read_word(const void* p) {
+    return *static_cast<const uint16_t*>(p);
+}
+inline uint32_t pgm_read_dword(const void* p) {
+    return *static_cast<const uint32_t*>(p);
+}
+
+// Time
+extern uint32_t hostMicros;                             // The host's notion of micros(); set by the host program
+inline uint32_t micros() {
+    return hostMicros;
+}
+inline uint32_t millis() {
+    return hostMicros / 1000;
+}
+inline void delayMicroseconds(unsigned int us) {
+    hostMicros += us;
+}
+inline void noInterrupts() {
+}
+inline void interrupts() {
+}
+
+// GPIO. The port registers are just memory; nothing drives the inputs unless the host program does.
+extern volatile uint8_t hostPin[NUM_DIGITAL_PINS / 8];  // PINx
+extern volatile uint8_t hostPort[NUM_DIGITAL_PINS / 8]; // PORTx
+extern volatile uint8_t hostDdr[NUM_DIGITAL_PINS / 8];  // DDRx
+#define digitalPinToPort(p) ((uint8_t)((p) / 8))
+#define digitalPinToBitMask(p) ((uint8_t)(1 << ((p) % 8)))
+#define portInputRegister(P) (&hostPin[P])
+#define portOutputRegister(P) (&hostPort[P])
+#define portModeRegister(P) (&hostDdr[P])
+inline void pinMode(uint8_t, uint8_t) {
+}
+inline void digitalWrite(uint8_t, uint8_t) {
+}
+inline int digitalRead(uint8_t pin) {
+    return (hostPin[digitalPinToPort(pin)] & digitalPinToBitMask(pin)) ? HIGH : LOW;
+}
+inline void analogWrite(uint8_t, int) {
+}
+
+// Print, as in the AVR core: what a serial port is to code that only writes to it
+class Print {
+public:
+    virtual ~Print() {
+    }
+    virtual size_t write(uint8_t b) = 0;
+    virtual size_t write(const uint8_t* buf, size_t n) {
+        size_t done = 0;
+        while (n-- > 0 && write(*buf++) == 1) {
+            done++;
+        }
+        return done;
+    }
+    virtual int availableForWrite() {
+        return 0;
+    }
+    size_t print(const char* s) {
+        return write(reinterpret_cast<const uint8_t*>(s), strlen(s));
+    }
+    size_t print(long v) {
+        char buf[12];
+        snprintf(buf, sizeof(buf), "%ld", v);
+        return print(buf);
+    }
+    size_t println(const char* s) {
+        return print(s) + print("\n");
+    }
+};
+
+// Serial. Output goes to file, if there is one; the transmit buffer always has room.
+class HardwareSerial : public Print {
+public:
+    void setFile(FILE* f) {
+        file = f;
+    }
+    int availableForWrite() override {
+        return 63;
+    }
+    size_t write(uint8_t b) override {
+        return write(&b, 1);
+    }
+    size_t write(const uint8_t* buf, size_t n) override {
+        return file ? fwrite(buf, 1, n, file) : n;
+    }
+private:
+    FILE* file = nullptr;
+};
+extern HardwareSerial Serial;
@@ -0,0 +1,38 @@
+/****
+ * This file is a part of the TouchSlider Arduino library. See TouchSlider.h for details. It's for host (PC) builds 
+ * only, not for the Arduino.
+ * 
+ * The storage for the host stand-ins for Arduino.h and EEPROM.h. Compile it along with the library sources.
+ *****
+ * 
+ * TouchSlider V1.0.2, November 2025
+ * Copyright (C) 2025 D.L. Ehnebuske
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ * 
+ ****/
+#include <Arduino.h>
+#include <EEPROM.h>
+
+uint32_t hostMicros = 0;
+volatile uint8_t hostPin[NUM_DIGITAL_PINS / 8];
+volatile uint8_t hostPort[NUM_DIGITAL_PINS / 8];
+volatile uint8_t hostDdr[NUM_DIGITAL_PINS / 8];
+HardwareSerial Serial;
+EEPROMClass EEPROM;
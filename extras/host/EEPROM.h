@@ -0,0 +1,81 @@
+/****
+ * This file is a part of the TouchSlider Arduino library. See TouchSlider.h for details. It's for host (PC) builds 
+ * only, not for the Arduino.
+ * 
+ * A stand-in for the Arduino EEPROM library: EEPROM_SIZE bytes of memory that start out erased (0xFF). It counts 
+ * the writes to each byte, to check wear leveling, and can be told to fail after a number of writes, to simulate 
+ * the power going off in the middle of saving something.
+ *****
+ * 
+ * TouchSlider V1.0.2, November 2025
+ * Copyright (C) 2025 D.L. Ehnebuske
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ * 
+ ****/
+#pragma once
+#include <Arduino.h>
+
+constexpr uint16_t EEPROM_SIZE = 1024;                  // Like an ATmega328P
+
+class EEPROMClass {
+public:
+    EEPROMClass() {
+        erase();
+    }
+    uint8_t read(int addr) {
+        return mem[addr];
+    }
+    void write(int addr, uint8_t val) {
+        if (writesLeft == 0) {
+            return;                                     // The power's off
+        }
+        if (writesLeft > 0) {
+            writesLeft--;
+        }
+        mem[addr] = val;
+        wear[addr]++;
+    }
+    void update(int addr, uint8_t val) {
+        if (mem[addr] != val) {
+            write(addr, val);
+        }
+    }
+    uint16_t length() {
+        return EEPROM_SIZE;
+    }
+
+    // Host only
+    void erase() {                                      // Erase everything and forget the wear
+        memset(mem, 0xFF, sizeof(mem));
+        memset(wear, 0, sizeof(wear));
+        writesLeft = -1;
+    }
+    uint32_t writes(int addr) {                         // The number of writes to addr since erase()
+        return wear[addr];
+    }
+    void failAfter(int32_t n) {                         // Ignore writes after the next n; -1 to never fail
+        writesLeft = n;
+    }
+private:
+    uint8_t mem[EEPROM_SIZE];                           // The contents
+    uint32_t wear[EEPROM_SIZE];                         // Writes to each byte
+    int32_t writesLeft;                                 // Writes before failing; -1 if never
+};
+extern EEPROMClass EEPROM;
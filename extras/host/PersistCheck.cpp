@@ -0,0 +1,131 @@
+/****
+ * This file is a part of the TouchSlider Arduino library. See TouchSlider.h for details. It's for host (PC) builds 
+ * only, not for the Arduino.
+ * 
+ * PersistCheck exercises TouchSlider's EEPROM persistence (setPersistence()) against the host EEPROM stand-in: 
+ * saving after the idle time, restoring after a "power cycle", spreading the writes around the ring, ignoring a 
+ * record whose write was cut short, and rejecting a saved value outside the new range. It prints a line per 
+ * check and exits with the number of checks that failed. Build it with
+ * 
+ *      g++ -std=gnu++11 -Iextras/host -Isrc extras/host/PersistCheck.cpp extras/host/ArduinoHost.cpp \
+ *          src/TouchSlider.cpp src/TouchSliderGroup.cpp -o persistcheck
+ *****
+ * 
+ * TouchSlider V1.0.2, November 2025
+ * Copyright (C) 2025 D.L. Ehnebuske
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ * 
+ ****/
+#include <Arduino.h>
+#include <EEPROM.h>
+#include <TouchSlider.h>
+
+constexpr uint16_t BASE = 100;                          // Where the ring goes
+constexpr uint8_t SLOTS = 4;                            // The number of records in the ring
+constexpr uint16_t IDLE_MS = 500;                       // Idle time before saving
+
+static uint8_t pins[] = {2, 3, 4, 5};                   // The pins the sensors are on
+static int failures = 0;                                // The number of checks that failed
+
+static void check(bool ok, const char* what) {
+    printf("%s  %s\n", ok ? "pass" : "FAIL", what);
+    failures += ok ? 0 : 1;
+}
+
+// Let ms milliseconds go by, calling run() every millisecond
+static void wait(uint32_t ms) {
+    for (uint32_t t = 0; t < ms; t++) {
+        hostMicros += 1000;
+        TouchSlider::run();
+    }
+}
+
+// Slide up one step, from sensor 0 to sensor 1, and lift the finger
+static void slideUp() {
+    TouchSensor::hostSet(pins[0], true);
+    TouchSensor::hostSet(pins[1], true);
+    TouchSensor::hostSet(pins[0], false);
+    TouchSensor::hostSet(pins[1], false);
+}
+
+// Power up a TouchSlider with persistence and return its starting value
+static tsl_value_t powerUp(TouchSlider& slider, tsl_value_t minV = 0, tsl_value_t maxV = 100) {
+    static TouchSlider::tsl_persist_stg_t persistStg;
+    slider.setPersistence(&persistStg, BASE, SLOTS, IDLE_MS);
+    slider.begin(minV, maxV, 50);
+    return slider.getValue();
+}
+
+int main() {
+    {
+        TouchSlider slider(pins, 4);
+        check(powerUp(slider) == 50, "erased EEPROM: starts with curV");
+        slideUp();
+        wait(IDLE_MS / 2);
+        check(EEPROM.read(BASE) == 0xFF, "nothing saved before the idle time");
+        wait(IDLE_MS);
+        check(EEPROM.read(BASE) != 0xFF, "saved once idle");
+        slider.end();
+    }
+    {
+        TouchSlider slider(pins, 4);
+        check(powerUp(slider) == 51, "power cycle: restores the saved value");
+
+        // Save many more times, with the records
+        for (uint8_t n = 0; n < 4 * SLOTS; n++) {
+            slideUp();
+            wait(IDLE_MS + 20);
+        }
+        // going around the ring. Every save writes its record's sequence number byte, so count those.
+        uint32_t lo = EEPROM.writes(BASE);
+        uint32_t hi = lo;
+        for (uint8_t slot = 0; slot < SLOTS; slot++) {
+            uint32_t w = EEPROM.writes(BASE + slot * PERSIST_RECORD_SIZE);
+            lo = w < lo ? w : lo;
+            hi = w > hi ? w : hi;
+        }
+        check(lo >= 4 && hi - lo <= 1, "saves are spread evenly around the ring");
+        check(EEPROM.writes(BASE + SLOTS * PERSIST_RECORD_SIZE) == 0, "nothing written past the ring");
+        slider.end();
+    }
+    {
+        TouchSlider slider(pins, 4);
+        check(powerUp(slider) == 51 + 4 * SLOTS, "power cycle after wrapping: restores the newest value");
+
+        // Cut the power partway through saving the next value: after its first byte. (Unchanged bytes aren't 
+        // written, so cutting it later might not leave the record incomplete.)
+        slideUp();
+        EEPROM.failAfter(1);
+        wait(IDLE_MS + 20);
+        EEPROM.failAfter(-1);
+        slider.end();
+    }
+    {
+        TouchSlider slider(pins, 4);
+        check(powerUp(slider) == 51 + 4 * SLOTS, "interrupted save: restores the last complete value");
+        slider.end();
+    }
+    {
+        TouchSlider slider(pins, 4);
+        check(powerUp(slider, 0, 10) == 50, "saved value out of the new range: starts with curV");
+        slider.end();
+    }
+    return failures;
+}
@@ -0,0 +1,106 @@
+/****
+ * This file is a part of the TouchSlider Arduino library. See TouchSlider.h for details. It's for host (PC) builds 
+ * only, not for the Arduino.
+ * 
+ * A stand-in for the TouchSensor library. Nothing is measured; instead, the host program says when the sensor on 
+ * a pin is touched or released by calling TouchSensor::hostSet(), and the sensor's handler is called just as the 
+ * real TouchSensor::run() would call it. Restarting a sensor (end() then begin()) forgets any touch, the way 
+ * recalibration does.
+ *****
+ * 
+ * TouchSlider V1.0.2, November 2025
+ * Copyright (C) 2025 D.L. Ehnebuske
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ * 
+ ****/
+#pragma once
+#define TouchSensor_h
+#include <Arduino.h>
+
+class TouchSensor {
+public:
+    using ts_handler_t = void (*)(uint8_t pin, void* client);
+
+    TouchSensor(uint8_t pin) : pin(pin) {
+    }
+    ~TouchSensor() {
+        end();
+    }
+    bool begin() {
+        if (pin >= NUM_DIGITAL_PINS) {
+            return false;
+        }
+        active(pin) = this;
+        touched = false;
+        return true;
+    }
+    void end() {
+        if (pin < NUM_DIGITAL_PINS && active(pin) == this) {
+            active(pin) = nullptr;
+        }
+    }
+    void setTouchedHandler(ts_handler_t handler, void* client) {
+        touchedHandler = handler;
+        touchedClient = client;
+    }
+    void setReleasedHandler(ts_handler_t handler, void* client) {
+        releasedHandler = handler;
+        releasedClient = client;
+    }
+    bool beingTouched() {
+        return touched;
+    }
+    static void run() {
+    }
+
+    /**
+     * @brief   Host only: touch or release the sensor on a pin, calling its handler if its state changes.
+     * 
+     * @param pin       The pin
+     * @param touch     True to touch, false to release
+     * @return true     The state changed and the handler, if any, was called
+     * @return false    No sensor on pin is in service, or it was already in that state
+     */
+    static bool hostSet(uint8_t pin, bool touch) {
+        TouchSensor* ts = pin < NUM_DIGITAL_PINS ? active(pin) : nullptr;
+        if (ts == nullptr || ts->touched == touch) {
+            return false;
+        }
+        ts->touched = touch;
+        ts_handler_t handler = touch ? ts->touchedHandler : ts->releasedHandler;
+        if (handler) {
+            handler(pin, touch ? ts->touchedClient : ts->releasedClient);
+        }
+        return true;
+    }
+
+private:
+    static TouchSensor*& active(uint8_t pin) {         // The sensor in service on each pin, if any
+        static TouchSensor* sensorOn[NUM_DIGITAL_PINS] = {};
+        return sensorOn[pin];
+    }
+
+    uint8_t pin;                                        // Our pin
+    bool touched = false;                               // Our state
+    ts_handler_t touchedHandler = nullptr;              // The touched handler, if any
+    void* touchedClient = nullptr;                      // The client-provided pointer passed to touchedHandler
+    ts_handler_t releasedHandler = nullptr;             // The released handler, if any
+    void* releasedClient = nullptr;                     // The client-provided pointer passed to releasedHandler
+};
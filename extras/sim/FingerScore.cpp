@@ -0,0 +1,122 @@
+/****
+ * This file is a part of the TouchSlider Arduino library. See TouchSlider.h for details. It's for host (PC) builds 
+ * only, not for the Arduino.
+ * 
+ * FingerScore scores the TouchSlider engine with FingerSim. For each of a set of scenarios -- slow and fast 
+ * slides, flicks, wide and narrow fingers, noise, a wheel -- it simulates the strokes, replays the edges into a 
+ * TouchSlider built against the host stand-ins in extras/host, and prints the steps expected and the steps 
+ * detected. Then it replays a long run of strokes as fast as it can and prints the throughput in edges per second 
+ * through onTouched() and onReleased(). Run it before and after a change to the engine to see what the change 
+ * did. Build it with
+ * 
+ *      g++ -std=gnu++11 -O2 -Iextras/host -Isrc extras/sim/FingerScore.cpp extras/host/ArduinoHost.cpp \
+ *          src/TouchSlider.cpp src/TouchSliderGroup.cpp -o fingerscore
+ * 
+ * adding -DTSL_VALUE_TYPE=int8_t, say, to score one of the narrow value types.
+ *****
+ * 
+ * TouchSlider V1.0.2, November 2025
+ * Copyright (C) 2025 D.L. Ehnebuske
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ * 
+ ****/
+#include <Arduino.h>
+#include <TouchSlider.h>
+#include <chrono>
+#include "FingerSim.h"
+
+struct scenario_t {                                     // One scenario
+    const char* name;                                   //   What it's called
+    uint8_t nPads;                                      //   The number of sensors
+    bool wheel;                                         //   True for a wheel
+    float noise;                                        //   Position noise, in sensors
+    std::vector<FingerSim::stroke_t> strokes;           //   What the finger does
+};
+
+static uint8_t pins[MAX_SENSORS] = {2, 3, 4, 5, 6, 7};  // The pins the sensors are on
+static const tsl_value_t midValue = (tsl_value_t)(((tsl_wide_t)TSL_VALUE_MIN + TSL_VALUE_MAX) / 2);
+                                                        // Where the value starts, so it can move either way
+                                                        //   whatever TSL_VALUE_TYPE is
+
+/**
+ * @brief   Replay edges into a TouchSlider and return how much its value changed.
+ * 
+ */
+static int32_t detect(TouchSlider& slider, const std::vector<FingerSim::edge_t>& edges) {
+    tsl_value_t before = slider.getValue();
+    FingerSim::replay(edges, [](const FingerSim::edge_t& e) {
+        TouchSensor::hostSet(pins[e.pad], e.touched);
+        TouchSlider::run();
+    });
+    return (int32_t)(slider.getValue() - before);
+}
+
+int main() {
+    TouchSlider::setClock(FingerSim::clockMillis, FingerSim::clockMicros);
+    const std::vector<scenario_t> scenarios = {
+        {"slow slide up", 6, false, 0.0f, {{0.0f, 5.0f, 0, 1000000, FingerSim::FS_CONSTANT, 1.2f}}},
+        {"fast slide down", 6, false, 0.0f, {{5.0f, 0.0f, 0, 60000, FingerSim::FS_EASE, 1.2f}}},
+        {"flick up", 6, false, 0.0f, {{0.0f, 4.0f, 0, 40000, FingerSim::FS_FLICK, 1.0f}}},
+        {"narrow finger", 6, false, 0.0f, {{0.0f, 5.0f, 0, 500000, FingerSim::FS_EASE, 0.6f}}},
+        {"wide finger", 6, false, 0.0f, {{0.0f, 5.0f, 0, 500000, FingerSim::FS_EASE, 1.8f}}},
+        {"noisy back and forth", 6, false, 0.08f, {
+            {0.0f, 5.0f, 0, 400000, FingerSim::FS_EASE, 1.2f},
+            {5.0f, 2.0f, 600000, 300000, FingerSim::FS_EASE, 1.2f},
+            {2.0f, 4.0f, 1100000, 300000, FingerSim::FS_EASE, 1.2f}}},
+        {"landing between sensors", 6, false, 0.0f, {{4.5f, 1.0f, 0, 300000, FingerSim::FS_EASE, 1.0f}}},
+        {"wheel, two turns", 4, true, 0.03f, {{0.0f, 8.0f, 0, 800000, FingerSim::FS_CONSTANT, 1.2f}}},
+    };
+
+    printf("%-26s %8s %8s %8s\n", "scenario", "expected", "detected", "error");
+    int32_t totalError = 0;
+    for (const scenario_t& sc : scenarios) {
+        TouchSlider slider(pins, sc.nPads);
+        slider.begin(TSL_VALUE_MIN, TSL_VALUE_MAX, midValue);
+        FingerSim sim(sc.nPads, sc.wheel);
+        sim.setNoise(sc.noise, 42);
+        int32_t expected = 0;
+        for (const FingerSim::stroke_t& st : sc.strokes) {
+            expected += sim.expectedSteps(st);
+        }
+        int32_t detected = detect(slider, sim.run(sc.strokes));
+        int32_t error = detected - expected;
+        totalError += error < 0 ? -error : error;
+        printf("%-26s %8ld %8ld %+8ld\n", sc.name, (long)expected, (long)detected, (long)error);
+        slider.end();
+    }
+    printf("total |error| %ld\n\n", (long)totalError);
+
+    // Throughput: many strokes back and forth, replayed without pause
+    std::vector<FingerSim::stroke_t> strokes;
+    for (uint32_t n = 0; n < 20000; n++) {
+        strokes.push_back({n % 2 ? 5.0f : 0.0f, n % 2 ? 0.0f : 5.0f, n * 250000, 200000, FingerSim::FS_EASE, 1.2f});
+    }
+    FingerSim sim(6);
+    std::vector<FingerSim::edge_t> edges = sim.run(strokes);
+    TouchSlider slider(pins, 6);
+    slider.begin(TSL_VALUE_MIN, TSL_VALUE_MAX, midValue);
+    auto start = std::chrono::steady_clock::now();
+    FingerSim::replay(edges, [](const FingerSim::edge_t& e) {
+        TouchSensor::hostSet(pins[e.pad], e.touched);
+    });
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    printf("throughput: %zu edges in %.3f s = %.0f edges/s\n", edges.size(), secs, edges.size() / secs);
+    return 0;
+}
@@ -0,0 +1,268 @@
+/****
+ * This file is a part of the TouchSlider Arduino library. See TouchSlider.h for details. It's for host (PC) builds 
+ * only, not for the Arduino.
+ * 
+ * FingerSim models a finger moving over a row (or ring) of N sensors and produces the sequence of touched and 
+ * released edges the TouchSensor layer would produce, with timestamps. The finger's movement is given as a list 
+ * of strokes, each with a start and end position, a start time, a duration, a speed profile and a contact width. 
+ * Position noise can be added. Sensor s covers positions s - 0.5 .. s + 0.5, and a sensor counts as touched when 
+ * the finger's contact covers at least overlap of it. The sensors are sampled every scan period, the way 
+ * TouchSensor::run() would see them, and each change in a sensor's state becomes an edge.
+ * 
+ * Edges can be fed to a host build of TouchSlider -- one built with the stand-ins in extras/host -- with 
+ * replay(), which also advances a virtual clock that can be handed to TouchSlider::setClock(). Comparing the 
+ * slider's net change with expectedSteps() scores its accuracy, and timing the replay of a long edge list gives 
+ * its throughput in events per second. FingerScore.cpp does both. In outline:
+ * 
+ *      uint8_t pins[] = {2, 3, 4, 5, 6, 7};
+ *      TouchSlider slider(pins, 6);
+ *      slider.begin(-1000, 1000, 0);
+ *      FingerSim sim(6);
+ *      sim.setNoise(0.05, 42);
+ *      std::vector<FingerSim::stroke_t> strokes = {{0.0, 5.0, 0, 300000, FingerSim::FS_EASE, 1.2}};
+ *      TouchSlider::setClock(FingerSim::clockMillis, FingerSim::clockMicros);
+ *      FingerSim::replay(sim.run(strokes), [&](const FingerSim::edge_t& e) { 
+ *          TouchSensor::hostSet(pins[e.pad], e.touched); 
+ *      });
+ *      // Compare slider.getValue() with sim.expectedSteps(strokes[0])
+ *****
+ * 
+ * TouchSlider V1.0.2, November 2025
+ * Copyright (C) 2025 D.L. Ehnebuske
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ * 
+ ****/
+#pragma once
+#include <stdint.h>
+#include <math.h>
+#include <vector>
+
+class FingerSim {
+public:
+    /**
+     * @brief   How the finger's speed varies over a stroke.
+     * 
+     *      FS_CONSTANT     The same speed throughout
+     *      FS_EASE         Speeding up and then slowing down, like most deliberate slides
+     *      FS_FLICK        Speeding up all the way, like a flick
+     */
+    enum fs_profile_t : uint8_t {FS_CONSTANT, FS_EASE, FS_FLICK};
+
+    /**
+     * @brief   One stroke: the finger touches at from, moves to to and is lifted.
+     * 
+     */
+    struct stroke_t {
+        float from;                                         // Where the finger touches, in sensors
+        float to;                                           // Where the finger is lifted, in sensors
+        uint32_t startMicros;                               // When the finger touches
+        uint32_t durationMicros;                            // How long the finger stays down
+        fs_profile_t profile;                               // How the speed varies along the way
+        float width;                                        // The width of the finger's contact, in sensors
+    };
+
+    /**
+     * @brief   One edge: a sensor being touched or released.
+     * 
+     */
+    struct edge_t {
+        uint32_t micros;                                    // When it happened
+        uint8_t pad;                                        // Which sensor
+        bool touched;                                       // True if touched, false if released
+    };
+
+    /**
+     * @brief Construct a new FingerSim object
+     * 
+     * @param nPads     The number of sensors
+     * @param wheel     True if the sensors form a ring, like a TouchSlider used as a wheel
+     */
+    FingerSim(uint8_t nPads, bool wheel = false) : nPads(nPads), wheel(wheel) {
+    }
+
+    /**
+     * @brief   Add random noise to the finger's position. The noise is generated from seed, so the same seed 
+     *          gives the same edges every time, on any host.
+     * 
+     * @param sigma     The standard deviation of the noise, in sensors. 0 (the default) for none.
+     * @param seed      The seed for the noise. Must not be 0.
+     */
+    void setNoise(float sigma, uint32_t seed = 1) {
+        noiseSigma = sigma;
+        rngState = seed == 0 ? 1 : seed;
+    }
+
+    /**
+     * @brief   Set how often the sensors are sampled, as TouchSensor::run() would.
+     * 
+     * @param micros    The sampling period in microseconds. Default 1000.
+     */
+    void setScanMicros(uint32_t micros) {
+        scanMicros = micros == 0 ? 1 : micros;
+    }
+
+    /**
+     * @brief   Set how much of a sensor the finger's contact must cover for it to be touched.
+     * 
+     * @param fraction  The fraction of a sensor. Default 0.25.
+     */
+    void setOverlap(float fraction) {
+        overlap = fraction;
+    }
+
+    /**
+     * @brief   Simulate a sequence of strokes.
+     * 
+     * @param strokes           The strokes, in order of startMicros, not overlapping
+     * @return std::vector<edge_t>  The edges they produce, in time order
+     */
+    std::vector<edge_t> run(const std::vector<stroke_t>& strokes) {
+        std::vector<edge_t> edges;
+        std::vector<bool> touched(nPads, false);
+        for (const stroke_t& st : strokes) {
+            uint32_t end = st.startMicros + st.durationMicros;
+            for (uint32_t t = st.startMicros; t < end; t += scanMicros) {
+                float u = (float)(t - st.startMicros) / st.durationMicros;
+                sample(t, st.from + (st.to - st.from) * shape(st.profile, u) + noise(), st.width, touched, edges);
+            }
+            for (uint8_t s = 0; s < nPads; s++) {
+                if (touched[s]) {
+                    touched[s] = false;
+                    edges.push_back(edge_t{end, s, false});
+                }
+            }
+        }
+        return edges;
+    }
+
+    /**
+     * @brief   The number of sensor-to-sensor steps a stroke should produce, as a TouchSlider counts them: the 
+     *          change in the sensor nearest the finger, positive for strokes toward higher-numbered sensors.
+     * 
+     * @param st        The stroke
+     * @return int32_t  The expected net steps
+     */
+    int32_t expectedSteps(const stroke_t& st) const {
+        float from = st.from;
+        float to = st.to;
+        if (!wheel) {
+            from = from < 0 ? 0 : from > nPads - 1 ? nPads - 1 : from;
+            to = to < 0 ? 0 : to > nPads - 1 ? nPads - 1 : to;
+        }
+        return (int32_t)lroundf(to) - (int32_t)lroundf(from);
+    }
+
+    /**
+     * @brief   Deliver edges, in order, advancing the virtual clock to each edge's time before delivering it.
+     * 
+     * @param edges     The edges, as from run()
+     * @param deliver   Called with each edge; typically sets the state of a stand-in TouchSensor
+     */
+    template <class F> static void replay(const std::vector<edge_t>& edges, F deliver) {
+        for (const edge_t& e : edges) {
+            virtualMicros() = e.micros;
+            deliver(e);
+        }
+    }
+
+    /**
+     * @brief   The virtual clock replay() advances, in the form TouchSlider::setClock() wants.
+     * 
+     */
+    static uint32_t clockMillis() {
+        return virtualMicros() / 1000;
+    }
+    static uint32_t clockMicros() {
+        return virtualMicros();
+    }
+
+    /**
+     * @brief   The virtual clock itself, for setting it directly, e.g., to let time pass between edges.
+     * 
+     * @return uint32_t&    The virtual time, in microseconds
+     */
+    static uint32_t& virtualMicros() {
+        static uint32_t now = 0;
+        return now;
+    }
+
+private:
+    // Where along the stroke the finger is, 0 .. 1, at fraction u of the stroke's duration
+    static float shape(fs_profile_t profile, float u) {
+        switch (profile) {
+            case FS_EASE:
+                return u * u * (3 - 2 * u);
+            case FS_FLICK:
+                return u * u;
+            default:
+                return u;
+        }
+    }
+
+    // Approximately normal noise with standard deviation noiseSigma: the sum of four uniform deviates (Irwin-Hall)
+    float noise() {
+        if (noiseSigma == 0) {
+            return 0;
+        }
+        float sum = 0;
+        for (uint8_t i = 0; i < 4; i++) {
+            rngState ^= rngState << 13;                     // xorshift32
+            rngState ^= rngState >> 17;
+            rngState ^= rngState << 5;
+            sum += (float)rngState / 4294967296.0f;
+        }
+        return (sum - 2.0f) * 1.7320508f * noiseSigma;      // Irwin-Hall(4) has variance 1/3
+    }
+
+    // How much of sensor s the contact lo .. hi covers
+    float covered(uint8_t s, float lo, float hi) const {
+        float total = 0;
+        int8_t shifts = wheel ? 1 : 0;
+        for (int8_t k = -shifts; k <= shifts; k++) {
+            float sLo = s - 0.5f + k * nPads;
+            float sHi = sLo + 1.0f;
+            float c = (hi < sHi ? hi : sHi) - (lo > sLo ? lo : sLo);
+            total += c > 0 ? c : 0;
+        }
+        return total;
+    }
+
+    // Sample the sensors with the finger at pos and record any edges
+    void sample(uint32_t t, float pos, float width, std::vector<bool>& touched, std::vector<edge_t>& edges) {
+        if (wheel) {
+            pos = fmodf(pos, nPads);
+            pos = pos < -0.5f ? pos + nPads : pos >= nPads - 0.5f ? pos - nPads : pos;
+        }
+        for (uint8_t s = 0; s < nPads; s++) {
+            bool now = covered(s, pos - width / 2, pos + width / 2) >= overlap;
+            if (now != touched[s]) {
+                touched[s] = now;
+                edges.push_back(edge_t{t, s, now});
+            }
+        }
+    }
+
+    uint8_t nPads;                                          // The number of sensors
+    bool wheel;                                             // True if the sensors form a ring
+    float noiseSigma = 0;                                   // Standard deviation of the position noise, in sensors
+    uint32_t rngState = 1;                                  // xorshift32 state for the noise
+    uint32_t scanMicros = 1000;                             // The sampling period
+    float overlap = 0.25f;                                  // Coverage it takes for a sensor to be touched
+};
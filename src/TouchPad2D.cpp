@@ -0,0 +1,162 @@
+/****
+ * This file is a part of the TouchSlider Arduino library for AVR architecture MPUs. See TouchPad2D.h for 
+ * details.
+ * 
+ *****
+ * 
+ * TouchSlider V1.0.2, November 2025
+ * Copyright (C) 2025 D.L. Ehnebuske
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ * 
+ ****/
+#include "TouchPad2D.h"
+
+// public member functions
+
+TouchPad2D::TouchPad2D(uint8_t colPins[], uint8_t nCols, uint8_t rowPins[], uint8_t nRows) : 
+    xAxis(colPins, nCols), yAxis(rowPins, nRows) {
+}
+
+bool TouchPad2D::begin(tsl_value_t xMax, tsl_value_t yMax) {
+    if (!xAxis.begin(0, xMax)) {
+        return false;
+    }
+    if (!yAxis.begin(0, yMax)) {
+        xAxis.end();
+        return false;
+    }
+    for (uint8_t s = 0; s < xAxis.nSensors; s++) {
+        xAxis.sensor[s].setTouchedHandler(touchedThunk, this);
+        xAxis.sensor[s].setReleasedHandler(releasedThunk, this);
+    }
+    for (uint8_t s = 0; s < yAxis.nSensors; s++) {
+        yAxis.sensor[s].setTouchedHandler(touchedThunk, this);
+        yAxis.sensor[s].setReleasedHandler(releasedThunk, this);
+    }
+    lastX = getX();
+    lastY = getY();
+    return true;
+}
+
+void TouchPad2D::end() {
+    xAxis.end();
+    yAxis.end();
+}
+
+void TouchPad2D::setMode(tsp_axis_t axis, tsp_mode_t mode) {
+    if (axis == TSP_X) {
+        xMode = mode;
+    } else {
+        yMode = mode;
+    }
+}
+
+TouchSlider& TouchPad2D::getAxis(tsp_axis_t axis) {
+    return axis == TSP_X ? xAxis : yAxis;
+}
+
+tsl_value_t TouchPad2D::getX() {
+    return coordinate(xAxis, xMode);
+}
+
+tsl_value_t TouchPad2D::getY() {
+    return coordinate(yAxis, yMode);
+}
+
+bool TouchPad2D::isTouched() {
+    return xAxis.touchedMask != 0 || yAxis.touchedMask != 0;
+}
+
+void TouchPad2D::setChangeHandler(tsp_handler_t handler, void* client) {
+    changeHandler = handler;
+    clientData = client;
+}
+
+void TouchPad2D::run() {
+    TouchSensor::run();
+    if (!xAxis.inService) {
+        return;
+    }
+    xAxis.tick();
+    yAxis.tick();
+    reportChange();
+}
+
+// private member functions
+
+void TouchPad2D::touchedThunk(uint8_t pin, void* client) {
+    static_cast<TouchPad2D*>(client)->dispatch(pin, true);
+}
+
+void TouchPad2D::releasedThunk(uint8_t pin, void* client) {
+    static_cast<TouchPad2D*>(client)->dispatch(pin, false);
+}
+
+void TouchPad2D::dispatch(uint8_t pin, bool touched) {
+    TouchSlider* axis = &xAxis;
+    uint8_t s = xAxis.sensorIndex(pin);
+    if (s == xAxis.nSensors) {
+        axis = &yAxis;
+        s = yAxis.sensorIndex(pin);
+        if (s == yAxis.nSensors) {
+            return;
+        }
+    }
+    if (touched) {
+        axis->onTouched(s);
+    } else {
+        axis->onReleased(s);
+    }
+    reportChange();
+}
+
+tsl_value_t TouchPad2D::coordinate(TouchSlider& axis, tsp_mode_t mode) {
+    return mode == TSP_ABSOLUTE ? position(axis) : axis.value;
+}
+
+uint8_t TouchPad2D::position(TouchSlider& axis) {
+    // Unlike a wheel, an axis doesn't wrap, so the position is midway between the lowest and highest sensors 
+    // being touched: 2 * s for sensor s alone, 2 * s + 1 for sensors s and s + 1.
+    if (axis.touchedMask == 0) {
+        return 2 * axis.restPad;
+    }
+    uint8_t lo = 0;
+    while (!(axis.touchedMask & ((tsl_mask_t)1 << lo))) {
+        lo++;
+    }
+    uint8_t hi = axis.nSensors - 1;
+    while (!(axis.touchedMask & ((tsl_mask_t)1 << hi))) {
+        hi--;
+    }
+    return lo + hi;
+}
+
+void TouchPad2D::reportChange() {
+    tsl_value_t x = getX();
+    tsl_value_t y = getY();
+    if (x == lastX && y == lastY) {
+        return;
+    }
+    lastX = x;
+    lastY = y;
+    if (changeHandler) {
+        changeHandler(x, y, clientData);
+    }
+}
@@ -0,0 +1,167 @@
+/****
+ * This file is a part of the TouchSlider Arduino library for AVR architecture MPUs. See TouchSlider.h for 
+ * details.
+ * 
+ * A TouchPad2D is a two-dimensional touchpad made from two arrays of self-capacitance touch sensors, one running 
+ * left to right (the columns, for X) and one running bottom to top (the rows, for Y). The usual way to build one 
+ * is as an interleaved diamond pattern: each column and each row is a chain of diamond-shaped pads, with the 
+ * column chains and row chains nested between one another so a finger anywhere touches both a column and a row.
+ * 
+ * Each axis is a TouchSlider, so all the slider machinery -- flick, hysteresis, fractional increments and the 
+ * rest -- is available per axis through getAxis(). The TouchPad2D takes over the touched and released callbacks 
+ * of both axes' TouchSensors, runs them through the axes' slide logic and reports the resulting X/Y position to 
+ * a single change handler. All the sensors are scanned in the same TouchSensor::run() sweep.
+ * 
+ * Each axis can be in one of two modes:
+ * 
+ *      TSP_RELATIVE    The axis's coordinate is its TouchSlider's value, 0 .. the max passed to begin(), which 
+ *                      slides move up and down -- like a laptop touchpad moving a pointer. This is the default.
+ *      TSP_ABSOLUTE    The axis's coordinate is where the finger is, in half-sensor units: 2 * s on sensor s 
+ *                      alone, 2 * s + 1 on sensors s and s + 1, so 0 .. 2 * (sensor count) - 2 -- like a 
+ *                      touchscreen. Unlike TouchSlider::getWheelPosition(), it doesn't wrap around.
+ *****
+ * 
+ * TouchSlider V1.0.2, November 2025
+ * Copyright (C) 2025 D.L. Ehnebuske
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ * 
+ ****/
+#pragma once
+#ifndef Arduino_h
+    #include <Arduino.h>                                // Arduino goop
+#endif
+#include "TouchSlider.h"                                // TouchSlider goop
+
+class TouchPad2D {
+public:
+    /**
+     * @brief Construct a new TouchPad2D object
+     * 
+     * @param colPins   The array of GPIO pin numbers to which the column sensors are attached, left to right.
+     * @param nCols     The number of pins in colPins. 2 <= nCols <= MAX_SENSORS
+     * @param rowPins   The array of GPIO pin numbers to which the row sensors are attached, bottom to top.
+     * @param nRows     The number of pins in rowPins. 2 <= nRows <= MAX_SENSORS
+     */
+    TouchPad2D(uint8_t colPins[], uint8_t nCols, uint8_t rowPins[], uint8_t nRows);
+
+    /**
+     * @brief   Put the TouchPad2D into service.
+     * 
+     * @param xMax      The largest X value in TSP_RELATIVE mode. 0 <= X <= xMax.
+     * @param yMax      The largest Y value in TSP_RELATIVE mode. 0 <= Y <= yMax.
+     * @return true     The TouchPad2D was successfully started
+     * @return false    The TouchPad2D was not successfully started
+     */
+    bool begin(tsl_value_t xMax, tsl_value_t yMax);
+
+    /**
+     * @brief   Take the TouchPad2D out of service. It can be put back into service by calling begin().
+     * 
+     */
+    void end();
+
+    /**
+     * @brief   The axes of a TouchPad2D.
+     * 
+     */
+    enum tsp_axis_t : uint8_t {TSP_X, TSP_Y};
+
+    /**
+     * @brief   The modes an axis can be in. See above.
+     * 
+     */
+    enum tsp_mode_t : uint8_t {TSP_RELATIVE, TSP_ABSOLUTE};
+
+    /**
+     * @brief   Set the mode of an axis.
+     * 
+     * @param axis      The axis
+     * @param mode      Its new mode
+     */
+    void setMode(tsp_axis_t axis, tsp_mode_t mode);
+
+    /**
+     * @brief   Get the TouchSlider that implements an axis, e.g., to configure its flick or hysteresis. Don't call 
+     *          its begin() or end(); use the TouchPad2D's.
+     * 
+     * @param axis          The axis
+     * @return TouchSlider& The axis's TouchSlider
+     */
+    TouchSlider& getAxis(tsp_axis_t axis);
+
+    /**
+     * @brief   Get the current X and Y coordinates.
+     * 
+     * @return tsl_value_t  The coordinate, according to the axis's mode.
+     */
+    tsl_value_t getX();
+    tsl_value_t getY();
+
+    /**
+     * @brief   Find out whether a finger is on the TouchPad2D.
+     * 
+     * @return true     Some sensor is being touched
+     * @return false    No sensor is being touched
+     */
+    bool isTouched();
+
+    /**
+     * @brief   The type a client-provided "touchpad change handler" function must have.
+     * 
+     * @param   x           The new X coordinate
+     * @param   y           The new Y coordinate
+     * @param   client      The value the client passed when the change handler was registered.
+     */
+    using tsp_handler_t = void (*)(tsl_value_t x, tsl_value_t y, void* client);
+
+    /**
+     * @brief   Set the changeHandler -- the function that will be called when X or Y changes.
+     * 
+     * @param handler   The function to call
+     * @param client    Client provided value. Whatever it is, it will be passed to the function when it's called.
+     */
+    void setChangeHandler(tsp_handler_t handler, void* client);
+
+    /**
+     * @brief   Update the state of all the TouchSensors, in a single sweep, and then do the time-driven work of 
+     *          both axes. Call this instead of TouchSensor::run() or TouchSlider::run() in loop(), and call it a 
+     *          lot.
+     * 
+     */
+    void run();
+
+private:
+    static void touchedThunk(uint8_t pin, void* client);    // What we register with TouchSensor as "touched" callback
+    static void releasedThunk(uint8_t pin, void* client);   // What we register with TouchSensor as "released" callback
+    void dispatch(uint8_t pin, bool touched);               // Run a sensor state change through its axis
+    tsl_value_t coordinate(TouchSlider& axis, tsp_mode_t mode);
+                                                            // An axis's coordinate, according to its mode
+    static uint8_t position(TouchSlider& axis);             // Where the finger is on an axis, in half-sensor units
+    void reportChange();                                    // Call the changeHandler if X or Y has changed
+
+    TouchSlider xAxis;                                      // The columns
+    TouchSlider yAxis;                                      // The rows
+    tsp_mode_t xMode = TSP_RELATIVE;                        // The mode of the X axis
+    tsp_mode_t yMode = TSP_RELATIVE;                        // The mode of the Y axis
+    tsl_value_t lastX = 0;                                  // X when the changeHandler was last called
+    tsl_value_t lastY = 0;                                  // Y when the changeHandler was last called
+    tsp_handler_t changeHandler = nullptr;                  // The client-provided change handler, if any
+    void* clientData;                                       // The client-provided pointer passed to changeHandler
+};
@@ -27,7 +27,13 @@
  * 
  ****/
 #include "TouchSlider.h"
+#include "TouchSliderGroup.h"
 #include <new>
+#include <EEPROM.h>
+
+TouchSlider* TouchSlider::firstInService = nullptr;
+TouchSlider::tsl_clock_t TouchSlider::clockMillis = TouchSlider::arduinoMillis;
+TouchSlider::tsl_clock_t TouchSlider::clockMicros = TouchSlider::arduinoMicros;
 
 // public member functions
 
@@ -43,31 +49,67 @@ TouchSlider::TouchSlider(uint8_t p[], uint8_t pCount) {
     }
 }
 
-bool TouchSlider::begin(int32_t minV, int32_t maxV, int32_t curV, int32_t inc) {
-    if (nSensors < 2) {
+bool TouchSlider::begin(tsl_value_t minV, tsl_value_t maxV, tsl_value_t curV, tsl_value_t inc) {
+    tsl_mask_t faults;
+    if (nSensors < 2 || (testAtBegin && !inService && (!selfTest(faults, testDiag) || faults != 0))) {
         return false;
     }
-    minValue = minV;
-    maxValue = maxV;
-    value = curV;
-    increment = inc;
+    return enterService(minV, maxV, curV, inc);
+}
 
-    for (uint8_t s = 0; s < nSensors; s++) {
-        if (!sensor[s].begin()) {
-            for (uint8_t ss = 0; ss <= s; ss++) {
-                sensor[ss].end();
-            }
-            return false;
+bool TouchSlider::begin() {
+    return begin(TSL_VALUE_MIN, TSL_VALUE_MAX);
+}
+
+bool TouchSlider::begin(const tsl_curve_t& curve, uint16_t curIndex) {
+    // Do all the checks begin() would before overwriting the table; it may be the one the old mapping uses
+    tsl_mask_t faults;
+    if (curve.table == nullptr || curve.len < 2 || curIndex >= curve.len || 
+        (uint32_t)(curve.len - 1) > (uint32_t)TSL_VALUE_MAX || (curve.shape != TSL_CURVE_LINEAR && !(curve.k > 0)) || 
+        nSensors < 2 || (testAtBegin && !inService && (!selfTest(faults, testDiag) || faults != 0))) {
+        return false;
+    }
+    float span = (float)curve.outMax - (float)curve.outMin;
+    float k = curve.k;
+    float kNorm = curve.shape == TSL_CURVE_LOG ? log(1.0 + k) : curve.shape == TSL_CURVE_EXP ? exp(k) - 1.0 : 1.0;
+    for (uint16_t ix = 0; ix < curve.len; ix++) {
+        float x = (float)ix / (curve.len - 1);
+        float y;
+        switch (curve.shape) {
+            case TSL_CURVE_LOG:
+                y = log(1.0 + k * x) / kNorm;
+                break;
+            case TSL_CURVE_EXP:
+                y = (exp(k * x) - 1.0) / kNorm;
+                break;
+            case TSL_CURVE_POWER:
+                y = pow(x, k);
+                break;
+            default:
+                y = x;
+                break;
         }
-        sensor[s].setTouchedHandler(touchedThunk, this);
-        sensor[s].setReleasedHandler(releasedThunk, this);
+        curve.table[ix] = (uint16_t)(curve.outMin + span * y + 0.5);          // Always >= 0, so this rounds
     }
-    inService = true;
-    return true;
-}
 
-bool TouchSlider::begin() {
-    return begin(MIN_MIN_32, MAX_MAX_32);
+    // Switch to the table, but put the old mapping back if the TouchSensors don't start
+    auto oldType = mapType;
+    const uint16_t* oldTable = mapTable;
+    uint16_t oldSpan = mapSpan;
+    bool oldProgmem = mapProgmem;
+    mapType = MAP_TABLE;
+    mapTable = curve.table;
+    mapSpan = curve.len - 1;
+    mapProgmem = false;
+    if (!enterService(0, curve.len - 1, curIndex, 1)) {
+        mapType = oldType;
+        mapTable = oldTable;
+        mapSpan = oldSpan;
+        mapProgmem = oldProgmem;
+        prepareOutput();
+        return false;
+    }
+    return true;
 }
 
 void TouchSlider::end() {
@@ -77,7 +119,344 @@ void TouchSlider::end() {
     for (uint8_t s= 0; s < nSensors; s++) {
         sensor[s].end();
     }
-    inService = false;
+    leaveService();
+}
+
+bool TouchSlider::reconfigure(uint8_t p[], uint8_t pCount) {
+    if (pCount < 2 || pCount > MAX_SENSORS) {
+        return false;
+    }
+
+    // Tear down the old TouchSensors and build the new ones in the same storage
+    for (uint8_t s = 0; s < nSensors; s++) {
+        if (inService) {
+            sensor[s].end();
+        }
+        sensor[s].~TouchSensor();
+    }
+    nSensors = pCount;
+    for (uint8_t s = 0; s < pCount; s++) {
+        new (&sensor[s]) TouchSensor(p[s]);
+        sensorPin[s] = p[s];
+        sensorTouched[s] = false;
+    }
+    nTouched = 0;
+    touchedMask = 0;
+    multiContact = false;
+    spread = 0;
+    flickVelocity = 0;
+    stepDir = 0;
+    reversing = false;
+    stepInterval = 0;
+    if (repeat) {
+        repeat->dir = 0;
+    }
+    if (gesture) {
+        gesture->state = GESTURE_IDLE;
+    }
+    restPad = 0;
+    lockDir = 0;
+    revPending = 0;
+    resetDrift();
+
+    if (inService && !startSensors()) {
+        leaveService();
+        return false;
+    }
+    return true;
+}
+
+void TouchSlider::run() {
+    TouchSensor::run();
+    for (TouchSlider* slider = firstInService; slider != nullptr; slider = slider->nextInService) {
+        slider->tick();
+    }
+}
+
+void TouchSlider::setClock(tsl_clock_t millisFn, tsl_clock_t microsFn) {
+    clockMillis = millisFn == nullptr ? arduinoMillis : millisFn;
+    clockMicros = microsFn == nullptr ? arduinoMicros : microsFn;
+}
+
+void TouchSlider::setGestureHandler(tsl_gesture_stg_t* stg, tsl_gesture_handler_t handler, void* client) {
+    if (stg == nullptr || handler == nullptr) {
+        gesture = nullptr;
+        return;
+    }
+    stg->handler = handler;
+    stg->client = client;
+    stg->state = GESTURE_IDLE;
+    stg->secondTap = false;
+    gesture = stg;
+}
+
+void TouchSlider::setAutoRepeat(tsl_repeat_stg_t* stg, uint16_t delayMs, uint16_t startMs, uint16_t minMs) {
+    if (stg == nullptr || delayMs == 0 || startMs == 0) {
+        repeat = nullptr;
+        return;
+    }
+    stg->delayMs = delayMs;
+    stg->startMs = startMs;
+    stg->minMs = minMs == 0 ? 1 : minMs;
+    stg->interval = startMs;
+    stg->dir = 0;
+    stg->pad = TSL_NO_PAD;
+    repeat = stg;
+}
+
+bool TouchSlider::setDetents(const tsl_value_t d[], uint8_t count, uint8_t hold) {
+    for (uint8_t ix = 1; ix < count; ix++) {
+        if (d[ix] <= d[ix - 1]) {
+            return false;
+        }
+    }
+    detent = d;
+    nDetents = count;
+    detentHold = hold;
+    detentHeld = 0;
+    detentIx = 0;
+    if (inService) {
+        seekDetent();
+    }
+    return true;
+}
+
+bool TouchSlider::setPersistence(tsl_persist_stg_t* stg, uint16_t base, uint8_t slots, uint16_t idleMs) {
+    if (slots == 1 || slots > 128 || (uint32_t)base + slots * PERSIST_RECORD_SIZE > EEPROM.length()) {
+        return false;
+    }
+    if (stg == nullptr || slots == 0) {
+        persist = nullptr;
+        return true;
+    }
+    stg->base = base;
+    stg->slots = slots;
+    stg->idleMs = idleMs;
+    stg->next = PERSIST_RECORD_SIZE;
+    persist = stg;
+    int32_t savedV;
+    restoreValue(savedV);                               // Find where the next record goes
+    stg->dirty = inService;                             // If we're already going, save the current value
+    return true;
+}
+
+void TouchSlider::setPalmRejection(bool reject) {
+    palmReject = reject;
+    checkContact = palmReject || twoFingerHandler != nullptr;
+}
+
+void TouchSlider::setCircular(bool circ) {
+    circular = circ;
+}
+
+void TouchSlider::setTwoFingerHandler(tsl_two_finger_handler_t handler, void* client) {
+    twoFingerHandler = handler;
+    twoFingerClientData = client;
+    checkContact = palmReject || twoFingerHandler != nullptr;
+}
+
+void TouchSlider::setReversalHysteresis(uint8_t edges, uint16_t ms) {
+    revEdges = edges;
+    revMs = ms;
+    lockDir = 0;
+    revPending = 0;
+}
+
+void TouchSlider::setFractionalIncrement(int32_t incQ16) {
+    fracIncrement = incQ16;
+    fracAccum = 0;
+}
+
+void TouchSlider::setDriftRecovery(tsl_drift_stg_t* stg, uint32_t stuckMs, uint32_t recalMs) {
+    if (stg == nullptr || stuckMs == 0) {
+        drift = nullptr;
+        return;
+    }
+    stg->stuckMs = stuckMs;
+    stg->recalMs = recalMs;
+    drift = stg;
+    resetDrift();
+    stg->sweepMillis = stg->changeMillis;
+}
+
+bool TouchSlider::selfTest(tsl_mask_t& faults, tsl_pad_diag_t* diag) {
+    if (inService || nSensors < 2) {
+        faults = (tsl_mask_t)~0;                        // So ignoring the result can't make this look like a pass
+        if (diag) {
+            for (uint8_t s = 0; s < MAX_SENSORS; s++) {
+                diag->fault[s] = TSL_PAD_UNTESTED;
+                diag->baseline[s] = 0;
+            }
+        }
+        return false;
+    }
+    tsl_pad_diag_t scratch;                             // Where the findings go if the client doesn't want them
+    if (diag == nullptr) {
+        diag = &scratch;
+    }
+    uint8_t* fault = diag->fault;
+    volatile uint8_t* in[MAX_SENSORS];
+    volatile uint8_t* out[MAX_SENSORS];
+    volatile uint8_t* ddr[MAX_SENSORS];
+    uint8_t bit[MAX_SENSORS];
+    uint16_t decay[MAX_SENSORS] = {};
+    tsl_mask_t all = 0;
+    for (uint8_t s = 0; s < nSensors; s++) {
+        uint8_t port = digitalPinToPort(sensorPin[s]);
+        in[s] = portInputRegister(port);
+        out[s] = portOutputRegister(port);
+        ddr[s] = portModeRegister(port);
+        bit[s] = digitalPinToBitMask(sensorPin[s]);
+        fault[s] = 0;
+        all |= (tsl_mask_t)1 << s;
+    }
+
+    // Measure how long each sensor takes to discharge through its ground resistor -- the time constant the 
+    // TouchSensors work with -- all the sensors at once. Interrupts are off so the polls are evenly spaced.
+    for (uint8_t sample = 0; sample < SELF_TEST_SAMPLES; sample++) {
+        noInterrupts();
+        for (uint8_t s = 0; s < nSensors; s++) {
+            *out[s] &= ~bit[s];
+            *ddr[s] |= bit[s];
+        }
+        delayMicroseconds(SELF_TEST_DISCHARGE_US);
+        for (uint8_t s = 0; s < nSensors; s++) {
+            if ((*in[s] & bit[s]) != 0) {
+                fault[s] |= TSL_PAD_SHORTED;                // Driven LOW but reads HIGH
+            }
+        }
+        for (uint8_t s = 0; s < nSensors; s++) {
+            *out[s] |= bit[s];
+        }
+        delayMicroseconds(SELF_TEST_CHARGE_US);
+        for (uint8_t s = 0; s < nSensors; s++) {
+            if ((*in[s] & bit[s]) == 0) {
+                fault[s] |= TSL_PAD_SHORTED;                // Driven HIGH but reads LOW
+            }
+        }
+        for (uint8_t s = 0; s < nSensors; s++) {
+            *ddr[s] &= ~bit[s];                             // Input, still pulled up for a moment
+        }
+        for (uint8_t s = 0; s < nSensors; s++) {
+            *out[s] &= ~bit[s];                             // Pull-up off; discharge through the resistor
+        }
+        tsl_mask_t pending = all;
+        for (uint8_t poll = 0; pending != 0 && poll < SELF_TEST_MAX_POLLS; poll++) {
+            for (uint8_t s = 0; s < nSensors; s++) {
+                if ((pending & ((tsl_mask_t)1 << s)) != 0 && (*in[s] & bit[s]) == 0) {
+                    decay[s] += poll;
+                    pending &= ~((tsl_mask_t)1 << s);
+                }
+            }
+        }
+        interrupts();
+        for (uint8_t s = 0; s < nSensors; s++) {
+            if ((pending & ((tsl_mask_t)1 << s)) != 0) {
+                if ((fault[s] & TSL_PAD_SHORTED) == 0) {
+                    fault[s] |= TSL_PAD_OPEN;               // Never discharged; no path to ground
+                }
+                decay[s] = SELF_TEST_MAX_POLLS * SELF_TEST_SAMPLES;
+            }
+        }
+    }
+
+    // Flag the sensors that discharge much faster than the average of the ones with no fault so far
+    uint32_t total = 0;
+    uint8_t nOk = 0;
+    for (uint8_t s = 0; s < nSensors; s++) {
+        diag->baseline[s] = decay[s] / SELF_TEST_SAMPLES;
+        if (fault[s] == 0) {
+            total += decay[s];
+            nOk++;
+        }
+    }
+    uint16_t mean = nOk == 0 ? 0 : total / nOk;
+    if (mean >= SELF_TEST_SAMPLES) {
+        for (uint8_t s = 0; s < nSensors; s++) {
+            if (fault[s] == 0 && decay[s] * 2 < mean) {
+                fault[s] |= TSL_PAD_OPEN;
+            }
+        }
+    }
+
+    // Look for bridges and crosstalk between each sensor and the others
+    for (uint8_t i = 0; i < nSensors; i++) {
+        if (fault[i] & TSL_PAD_SHORTED) {
+            continue;
+        }
+        noInterrupts();
+        for (uint8_t s = 0; s < nSensors; s++) {
+            *ddr[s] &= ~bit[s];
+            *out[s] |= bit[s];
+        }
+        *out[i] &= ~bit[i];
+        *ddr[i] |= bit[i];
+        delayMicroseconds(SELF_TEST_SETTLE_US);
+        for (uint8_t s = 0; s < nSensors; s++) {
+            if (s != i && (fault[s] & TSL_PAD_SHORTED) == 0 && (*in[s] & bit[s]) == 0) {
+                fault[s] |= TSL_PAD_BRIDGED;
+                fault[i] |= TSL_PAD_BRIDGED;
+            }
+        }
+        for (uint8_t s = 0; s < nSensors; s++) {
+            *out[s] &= ~bit[s];
+            *ddr[s] |= bit[s];
+        }
+        delayMicroseconds(SELF_TEST_DISCHARGE_US);
+        for (uint8_t s = 0; s < nSensors; s++) {
+            if (s != i) {
+                *ddr[s] &= ~bit[s];
+            }
+        }
+        *out[i] |= bit[i];
+        delayMicroseconds(SELF_TEST_COUPLE_US);             // Let the coupled charge get through the synchronizers
+        for (uint8_t s = 0; s < nSensors; s++) {
+            if (s != i && fault[s] == 0 && (*in[s] & bit[s]) != 0) {
+                fault[s] |= TSL_PAD_CROSSTALK;
+                fault[i] |= TSL_PAD_CROSSTALK;
+            }
+        }
+        interrupts();
+    }
+
+    // Leave the pins as plain inputs and report
+    faults = 0;
+    noInterrupts();
+    for (uint8_t s = 0; s < nSensors; s++) {
+        *ddr[s] &= ~bit[s];
+        *out[s] &= ~bit[s];
+        if (fault[s] != 0) {
+            faults |= (tsl_mask_t)1 << s;
+        }
+    }
+    interrupts();
+    return true;
+}
+
+void TouchSlider::setSelfTest(bool test, tsl_pad_diag_t* diag) {
+    testAtBegin = test;
+    testDiag = diag;
+}
+
+void TouchSlider::setTelemetry(tsl_telemetry_stg_t* stg, Print* port, uint8_t id, uint16_t periodMs) {
+    if (stg == nullptr || port == nullptr) {
+        telemetry = nullptr;
+        return;
+    }
+    stg->port = port;
+    stg->id = id;
+    stg->seq = 0;
+    stg->period = periodMs;
+    stg->changes = 0;
+    stg->frameMillis = clockMillis();
+    stg->changeMicros = clockMicros();
+    telemetry = stg;
+}
+
+void TouchSlider::setFlick(uint16_t minSpeed, uint8_t decay) {
+    flickMinSpeed = minSpeed;
+    flickDecay = decay;
+    flickVelocity = 0;
 }
 
 TouchSlider::~TouchSlider() {
@@ -85,6 +464,9 @@ TouchSlider::~TouchSlider() {
         return;
     }
 
+    if (group) {
+        group->remove(groupId);                 // So the group doesn't go on dispatching to us
+    }
     end();
 
     for (uint8_t s = 0; s < nSensors; s++) {
@@ -97,7 +479,143 @@ void TouchSlider::setChangeHandler(tsl_handler_t handler, void* client) {
     clientData = client;
 }
 
-int32_t TouchSlider::getValue() {
+void TouchSlider::setEventHandler(tsl_event_handler_t handler, void* client) {
+    eventHandler = handler;
+    eventClientData = client;
+}
+
+bool TouchSlider::subscribe(tsl_handler_t handler, void* client, tsl_filter_t filter, uint8_t param) {
+    #if MAX_SUBSCRIBERS > 0
+    if (handler == nullptr || nSubscribers >= MAX_SUBSCRIBERS || (filter == TSL_EVERY_NTH && param == 0)) {
+        return false;
+    }
+    subscriber[nSubscribers] = {handler, client, filter, param, 0};
+    nSubscribers++;
+    return true;
+    #else
+    (void)handler; (void)client; (void)filter; (void)param;
+    return false;                                       // Built without a subscriber table
+    #endif
+}
+
+bool TouchSlider::unsubscribe(tsl_handler_t handler, void* client) {
+    #if MAX_SUBSCRIBERS > 0
+    for (uint8_t sub = 0; sub < nSubscribers; sub++) {
+        if (subscriber[sub].handler == handler && subscriber[sub].client == client) {
+            nSubscribers--;
+            for (uint8_t ss = sub; ss < nSubscribers; ss++) {
+                subscriber[ss] = subscriber[ss + 1];
+            }
+            subscriber[nSubscribers].handler = nullptr;
+            return true;
+        }
+    }
+    #else
+    (void)handler; (void)client;
+    #endif
+    return false;
+}
+
+void TouchSlider::bindPwm(uint8_t pin) {
+    sinkType = SINK_PWM;
+    sink.pin = pin;
+    prepareOutput();
+}
+
+void TouchSlider::bindRegister(volatile uint8_t* reg) {
+    sinkType = SINK_REG8;
+    sink.reg8 = reg;
+    prepareOutput();
+}
+
+void TouchSlider::bindRegister(volatile uint16_t* reg) {
+    sinkType = SINK_REG16;
+    sink.reg16 = reg;
+    prepareOutput();
+}
+
+void TouchSlider::unbind() {
+    sinkType = SINK_NONE;
+}
+
+void TouchSlider::setOutputRange(uint16_t outMin, uint16_t outMax) {
+    mapType = MAP_LINEAR;
+    mapOutMin = outMin;
+    mapOutMax = outMax;
+    mapSpan = outMax > outMin ? outMax - outMin : outMin - outMax;
+    prepareOutput();
+}
+
+bool TouchSlider::setOutputTable(const uint16_t table[], uint16_t len, bool progmem) {
+    if (len < 2) {
+        return false;
+    }
+    mapType = MAP_TABLE;
+    mapTable = table;
+    mapSpan = len - 1;
+    mapProgmem = progmem;
+    prepareOutput();
+    return true;
+}
+
+uint16_t TouchSlider::getOutput() {
+    return mapValue();
+}
+
+int32_t TouchSlider::takeDelta() {
+    int32_t delta = deltaAccum;
+    deltaAccum = 0;
+    return delta;
+}
+
+void TouchSlider::setDeltaUnclamped(bool unclamped) {
+    deltaUnclamped = unclamped;
+    deltaAccum = 0;
+}
+
+void TouchSlider::setClamped(bool clamp) {
+    clamped = clamp;
+}
+
+uint8_t TouchSlider::getWheelPosition() {
+    if (touchedMask == 0) {
+        return 2 * restPad;
+    }
+    tsl_mask_t last = (tsl_mask_t)1 << (nSensors - 1);
+    if ((touchedMask & last) && (touchedMask & 1)) {
+        return 2 * nSensors - 1;                // Straddling the last and first sensors
+    }
+    uint8_t s = 0;
+    while (!(touchedMask & ((tsl_mask_t)1 << s))) {
+        s++;
+    }
+    return s + 1 < nSensors && (touchedMask & ((tsl_mask_t)1 << (s + 1))) ? 2 * s + 1 : 2 * s;
+}
+
+uint16_t TouchSlider::getWheelAngle() {
+    if (nSensors < 2) {
+        return 0;
+    }
+    return (uint16_t)(((uint32_t)getWheelPosition() << 15) / nSensors);
+}
+
+int32_t TouchSlider::getRevolutions() {
+    return revolutions;
+}
+
+int32_t TouchSlider::getWheelVelocity() {
+    if (stepInterval == 0 || nSensors < 2) {
+        return 0;
+    }
+    // Once the finger stops, use the time since the last step, so the estimate falls off
+    uint32_t sinceLast = clockMicros() - lastStepMicros;
+    uint32_t interval = sinceLast > stepInterval ? sinceLast : stepInterval;
+    // Steps per second in 16ths, times 65536 / 16 / nSensors, all in 32 bits; an interval under 16 us can't happen
+    uint32_t sixteenths = 16000000UL / (interval < 16 ? 16 : interval);
+    return (int32_t)(sixteenths * 4096 / nSensors) * stepDir;
+}
+
+tsl_value_t TouchSlider::getValue() {
     return value;
 }
 
@@ -111,72 +629,797 @@ void TouchSlider::printState() {
 
 // private member functions
 
-void TouchSlider::touchedThunk(uint8_t pin, void* client) {
-    auto* instance = static_cast<TouchSlider*>(client);
-    instance->onTouched(pin);
+uint32_t TouchSlider::arduinoMillis() {
+    return millis();
+}
+
+uint32_t TouchSlider::arduinoMicros() {
+    return micros();
+}
+
+bool TouchSlider::enterService(tsl_value_t minV, tsl_value_t maxV, tsl_value_t curV, tsl_value_t inc) {
+    minValue = minV;
+    maxValue = maxV;
+    value = curV;
+    increment = inc;
+    int32_t savedV;
+    if (persist && restoreValue(savedV) && savedV >= minV && savedV <= maxV) {
+        value = savedV;
+    }
+    if (persist) {
+        persist->dirty = false;
+    }
+
+    if (!startSensors()) {
+        return false;
+    }
+    nTouched = 0;
+    touchedMask = 0;
+    multiContact = false;
+    spread = 0;
+    revolutions = 0;
+    fracAccum = 0;
+    flickVelocity = 0;
+    if (repeat) {
+        repeat->dir = 0;
+    }
+    if (gesture) {
+        gesture->state = GESTURE_IDLE;
+    }
+    restPad = 0;
+    lockDir = 0;
+    revPending = 0;
+    detentIx = 0;
+    detentHeld = 0;
+    seekDetent();
+    resetDrift();
+    if (!inService) {
+        nextInService = firstInService;
+        firstInService = this;
+    }
+    inService = true;
+    prepareOutput();
+    return true;
+}
+
+bool TouchSlider::startSensors() {
+    for (uint8_t s = 0; s < nSensors; s++) {
+        if (!sensor[s].begin()) {
+            for (uint8_t ss = 0; ss <= s; ss++) {
+                sensor[ss].end();
+            }
+            return false;
+        }
+        sensor[s].setTouchedHandler(touchedThunk, this);
+        sensor[s].setReleasedHandler(releasedThunk, this);
+    }
+    return true;
+}
+
+void TouchSlider::leaveService() {
+    for (TouchSlider** link = &firstInService; *link != nullptr; link = &(*link)->nextInService) {
+        if (*link == this) {
+            *link = nextInService;
+            break;
+        }
+    }
+    nextInService = nullptr;
+    inService = false;
 }
 
-void TouchSlider::onTouched(uint8_t pin) {
-    uint8_t sensorS = NUM_DIGITAL_PINS;
+uint8_t TouchSlider::sensorIndex(uint8_t pin) {
     for (uint8_t sNo = 0; sNo < nSensors; sNo++) {
         if (pin == sensorPin[sNo]) {
-            sensorS = sNo;
-            break;
+            return sNo;
         }
     }
+    return nSensors;
+}
+
+void TouchSlider::touchedThunk(uint8_t pin, void* client) {
+    auto* instance = static_cast<TouchSlider*>(client);
+    uint8_t sensorS = instance->sensorIndex(pin);
+    if (sensorS < instance->nSensors) {
+        instance->onTouched(sensorS);
+    }
+}
+
+void TouchSlider::onTouched(uint8_t sensorS) {
     uint8_t sensorPrev = sensorS == 0 ? nSensors - 1 : sensorS - 1;
     bool nowTouchedPrev = sensor[sensorPrev].beingTouched();
     bool wasTouchedPrev = sensorTouched[sensorPrev];
 
     sensorTouched[sensorS] = true;
     sensorTouched[sensorPrev] = nowTouchedPrev;
+    touchedMask |= (tsl_mask_t)1 << sensorS;
+    if (nTouched++ == 0) {
+        stepDir = 0;                            // A new touch; its steps start a new run
+        reversing = false;
+        stepInterval = 0;
+    }
+    if (telemetry) {
+        noteTelemetry(clockMicros());
+    }
+    flickVelocity = 0;
+    if (repeat) {
+        repeat->dir = 0;
+    }
+    if (gesture) {
+        gestureTouched(sensorS);
+    }
+    bool ok = !checkContact || contactOk();
 
-    int64_t inc = wasTouchedPrev && nowTouchedPrev ? increment : 0;
-    
     // Return if no slide
-    if (inc == 0) {
+    if (!(ok && wasTouchedPrev && nowTouchedPrev) || (revEdges > 1 && !acceptStep(1))) {
         return;
     }
 
-    int64_t newValue = (int64_t)value + inc;
-    newValue = newValue > maxValue ? maxValue : newValue < minValue ? minValue : newValue;
-    if (newValue != value && changeHandler) {
-        changeHandler(newValue, clientData);
+    noteStep(1);
+    if (sensorS == 0) {
+        revolutions++;
+    }
+    stepValue(1, sensorS, STEP_SLIDE);
+
+    // Arm auto-repeat if the slide up arrived at the last sensor of a linear TouchSlider
+    if (repeat && !circular && sensorS == nSensors - 1) {
+        repeat->dir = 1;
+        repeat->pad = sensorS;
+        repeat->lastMillis = clockMillis();
+        repeat->repeating = false;
     }
-    value = newValue;
 }
 
 void TouchSlider::releasedThunk(uint8_t pin, void* client) {
     auto* instance = static_cast<TouchSlider*>(client);
-    instance->onReleased(pin);
+    uint8_t sensorS = instance->sensorIndex(pin);
+    if (sensorS < instance->nSensors) {
+        instance->onReleased(sensorS);
+    }
 }
 
-void TouchSlider::onReleased(uint8_t pin) {
-    uint8_t sensorS = NUM_DIGITAL_PINS;
-    for (uint8_t sNo = 0; sNo < nSensors; sNo++) {
-        if (pin == sensorPin[sNo]) {
-            sensorS = sNo;
-            break;
-        }
-    }
+void TouchSlider::onReleased(uint8_t sensorS) {
     uint8_t sensorPrev = sensorS == 0 ? nSensors - 1 : sensorS - 1;
     bool nowTouchedPrev = sensor[sensorPrev].beingTouched();
     bool wasTouchedPrev = sensorTouched[sensorPrev];
 
     sensorTouched[sensorS] = false;
     sensorTouched[sensorPrev] = nowTouchedPrev;
+    touchedMask &= ~((tsl_mask_t)1 << sensorS);
+    if (nTouched > 0) {
+        nTouched--;
+    }
+    if (telemetry) {
+        noteTelemetry(clockMicros());
+    }
+    if (repeat && sensorS == repeat->pad) {
+        repeat->dir = 0;
+    }
+    bool ok = !checkContact || contactOk();
 
-    int64_t inc = wasTouchedPrev && nowTouchedPrev ? -increment : 0;
-    
-    // Return if no slide
-    if (inc == 0) {
+    // If there's a slide, deal with it
+    if (ok && wasTouchedPrev && nowTouchedPrev && (revEdges < 2 || acceptStep(-1))) {
+        noteStep(-1);
+        if (sensorS == 0) {
+            revolutions--;
+        }
+        stepValue(-1, sensorS, STEP_SLIDE);
+
+        // Arm auto-repeat if the slide down arrived at the first sensor of a linear TouchSlider
+        if (repeat && !circular && sensorS == 1) {
+            repeat->dir = -1;
+            repeat->pad = 0;
+            repeat->lastMillis = clockMillis();
+            repeat->repeating = false;
+        }
+    }
+
+    if (nTouched == 0) {
+        restPad = sensorS;
+        onIdle();
+    }
+}
+
+void TouchSlider::stepValue(tsl_wide_t steps, uint8_t pad, step_source_t src) {
+    if (fracIncrement == 0) {
+        changeValue(steps * increment, pad, src);
         return;
     }
+    fracAccum += steps * fracIncrement;
+    int32_t whole = fracAccum / 65536;
+    if (whole != 0) {
+        fracAccum -= whole * 65536;
+        changeValue(whole, pad, src);
+    }
+}
 
-    int64_t newValue = (int64_t)value + inc;
-    newValue = newValue > maxValue ? maxValue : newValue < minValue ? minValue : newValue;
-    if (newValue != value && changeHandler) {
-        changeHandler(newValue, clientData);
+void TouchSlider::changeValue(tsl_wide_t inc, uint8_t pad, step_source_t src) {
+    if (deltaUnclamped) {
+        deltaAccum += inc;
+    }
+    tsl_wide_t newValue = (tsl_wide_t)value + inc;
+    if (clamped) {
+        newValue = newValue > maxValue ? maxValue : newValue < minValue ? minValue : newValue;
+    } else {
+        newValue = newValue > TSL_VALUE_MAX ? TSL_VALUE_MAX : newValue < TSL_VALUE_MIN ? TSL_VALUE_MIN : newValue;
+    }
+    if (newValue == value) {
+        return;
+    }
+    if (nDetents != 0) {
+        bool atDetent = detentIx > 0 && detent[detentIx - 1] == value;
+        if (atDetent && detentHeld < detentHold) {
+            detentHeld++;                       // Stuck at the detent
+            return;
+        }
+        // Stop at the next detent in the direction we're going, if we'd reach or pass it
+        if (newValue > value) {
+            if (detentIx < nDetents && newValue >= detent[detentIx]) {
+                newValue = detent[detentIx];
+            }
+        } else {
+            uint8_t below = atDetent ? detentIx - 1 : detentIx;
+            if (below > 0 && newValue <= detent[below - 1]) {
+                newValue = detent[below - 1];
+            }
+        }
+        detentHeld = 0;
     }
+    int32_t delta = newValue - value;
+    if (!deltaUnclamped) {
+        deltaAccum += delta;
+    }
+    uint32_t now = clockMicros();
+    lastChangeMicros = now;
     value = newValue;
-}
\ No newline at end of file
+    if (persist) {
+        persist->dirty = true;
+    }
+    if (nDetents != 0) {
+        seekDetent();
+    }
+    if (sinkType != SINK_NONE) {
+        writeOutput();
+    }
+    if (telemetry) {
+        noteTelemetry(now);
+    }
+    if (changeHandler) {
+        changeHandler(value, clientData);
+    }
+    if (eventHandler) {
+        tsl_event_t event;
+        event.value = value;
+        event.delta = delta;
+        event.pad = pad;
+        event.micros = now;
+        event.velocity = eventVelocity(delta, src);
+        event.output = mapValue();
+        eventHandler(event, eventClientData);
+    }
+    #if MAX_SUBSCRIBERS > 0
+    for (uint8_t sub = 0; sub < nSubscribers; sub++) {
+        subscriber_t &s = subscriber[sub];
+        switch (s.filter) {
+            case TSL_EVERY_CHANGE:
+                s.handler(value, s.client);
+                break;
+            case TSL_EVERY_NTH:
+                if (++s.count >= s.param) {
+                    s.count = 0;
+                    s.handler(value, s.client);
+                }
+                break;
+            case TSL_WHEN_IDLE:
+                s.count = 1;
+                break;
+        }
+    }
+    #endif
+}
+
+int32_t TouchSlider::eventVelocity(int32_t delta, step_source_t src) {
+    // Steps per second behind the change: the auto-repeat rate, the flick's speed or the interval between the 
+    // slide's latest steps. The first step of a touch has no interval yet.
+    uint32_t rate;
+    if (src == STEP_REPEAT) {
+        rate = 1000UL / repeat->interval;
+    } else if (src == STEP_FLICK) {
+        rate = (uint32_t)(flickVelocity < 0 ? -flickVelocity : flickVelocity) * 1000 / (256UL * FLICK_PERIOD_MS);
+    } else if (stepInterval != 0) {
+        rate = 1000000UL / stepInterval;
+    } else {
+        return 0;
+    }
+    // Scale by the change per step. A Q16.16 increment is done in halves, so the 32-bit product can't overflow.
+    uint32_t perSec;
+    if (fracIncrement == 0) {
+        tsl_wide_t inc = increment;                     // Signed even when tsl_value_t isn't
+        perSec = rate * (uint32_t)(inc < 0 ? -inc : inc);
+    } else {
+        uint32_t inc = fracIncrement < 0 ? -fracIncrement : fracIncrement;
+        perSec = rate * (inc >> 16) + ((rate * (inc & 0xFFFF)) >> 16);
+    }
+    return delta < 0 ? -(int32_t)perSec : (int32_t)perSec;
+}
+
+void TouchSlider::onIdle() {
+    lockDir = 0;
+    revPending = 0;
+    if (gesture) {
+        gestureReleased();
+    }
+
+    // Start a flick if the finger was lifted right after a fast enough slide. The value isn't final until the 
+    // flick ends, so TSL_WHEN_IDLE subscribers hear about it then.
+    if (flickMinSpeed == 0 || stepInterval == 0 || clockMicros() - lastStepMicros > FLICK_LIFT_MS * 1000UL || 
+        1000000UL / stepInterval < flickMinSpeed) {
+        notifyIdle();
+        return;
+    }
+    // steps/s * 256 * FLICK_PERIOD_MS / 1000 == 256000 * FLICK_PERIOD_MS / stepInterval
+    flickVelocity = (int32_t)(256000UL * FLICK_PERIOD_MS / stepInterval) * stepDir;
+    flickAccum = 0;
+    flickMillis = clockMillis();
+}
+
+void TouchSlider::notifyIdle() {
+    #if MAX_SUBSCRIBERS > 0
+    for (uint8_t sub = 0; sub < nSubscribers; sub++) {
+        if (subscriber[sub].filter == TSL_WHEN_IDLE && subscriber[sub].count != 0) {
+            subscriber[sub].count = 0;
+            subscriber[sub].handler(value, subscriber[sub].client);
+        }
+    }
+    #endif
+}
+
+void TouchSlider::noteStep(int8_t dir) {
+    uint32_t now = clockMicros();
+    if (gesture && gesture->state == GESTURE_DOWN) {
+        gesture->state = GESTURE_NONE;          // A slide isn't a tap or hold
+        noteEarlierTap();
+    }
+    if (dir == stepDir) {
+        // Another step in the current run
+        stepInterval = now - lastStepMicros;
+        lastStepMicros = now;
+        reversing = false;
+    } else if (!reversing) {
+        // Maybe a reversal, maybe just the finger rolling off two sensors as it's lifted. Wait and see.
+        reversing = true;
+        reverseMicros = now;
+    } else {
+        // A second step in the new direction; it's a reversal. Start a new run.
+        stepDir = dir;
+        stepInterval = now - reverseMicros;
+        lastStepMicros = now;
+        reversing = false;
+    }
+}
+
+void TouchSlider::tick() {
+    if (flickVelocity != 0) {
+        tickFlick();
+    }
+    if (gesture && (gesture->state == GESTURE_DOWN || gesture->state == GESTURE_TAPPED)) {
+        tickGesture();
+    }
+    if (repeat && repeat->dir != 0) {
+        tickRepeat();
+    }
+    if (persist) {
+        tickPersist();
+    }
+    if (drift) {
+        tickDrift();
+    }
+    if (telemetry) {
+        tickTelemetry();
+    }
+}
+
+bool TouchSlider::restoreValue(int32_t& v) {
+    // Find the newest valid record: the one not followed by a valid record with the next sequence number. Also 
+    // set things up so the next record written follows it.
+    bool found = false;
+    uint8_t rec[PERSIST_RECORD_SIZE];
+    for (uint8_t slot = 0; slot < persist->slots && !found; slot++) {
+        uint16_t addr = persist->base + slot * PERSIST_RECORD_SIZE;
+        uint8_t check = 0;
+        for (uint8_t b = 0; b < PERSIST_RECORD_SIZE; b++) {
+            rec[b] = EEPROM.read(addr + b);
+            check ^= rec[b];
+        }
+        if (check != 0xFF) {
+            continue;                                   // Not valid (e.g., never written or write interrupted)
+        }
+        uint8_t nextSlot = slot + 1 == persist->slots ? 0 : slot + 1;
+        uint16_t nextAddr = persist->base + nextSlot * PERSIST_RECORD_SIZE;
+        uint8_t nextCheck = 0;
+        for (uint8_t b = 0; b < PERSIST_RECORD_SIZE; b++) {
+            nextCheck ^= EEPROM.read(nextAddr + b);
+        }
+        if (nextCheck == 0xFF && EEPROM.read(nextAddr) == (uint8_t)(rec[0] + 1)) {
+            continue;                                   // There's a newer one
+        }
+        found = true;
+        v = (int32_t)((uint32_t)rec[1] | (uint32_t)rec[2] << 8 | (uint32_t)rec[3] << 16 | (uint32_t)rec[4] << 24);
+        persist->seq = rec[0] + 1;
+        persist->slot = nextSlot;
+    }
+    if (!found) {
+        persist->seq = 0;
+        persist->slot = 0;
+    }
+    return found;
+}
+
+void TouchSlider::tickPersist() {
+    if (persist->next == PERSIST_RECORD_SIZE) {
+        // Not writing. See whether it's time to start.
+        if (!persist->dirty || nTouched != 0 || clockMicros() - lastChangeMicros < persist->idleMs * 1000UL) {
+            return;
+        }
+        persist->record[0] = persist->seq;
+        uint8_t check = persist->seq;
+        for (uint8_t b = 1; b < PERSIST_RECORD_SIZE - 1; b++) {
+            persist->record[b] = (uint32_t)value >> (8 * (b - 1));
+            check ^= persist->record[b];
+        }
+        persist->record[PERSIST_RECORD_SIZE - 1] = ~check;
+        persist->dirty = false;
+        persist->next = 0;
+    }
+    #ifdef __AVR__
+    if (!eeprom_is_ready()) {
+        return;                                         // Still busy with the last byte; don't wait for it
+    }
+    #endif
+    EEPROM.update(persist->base + persist->slot * PERSIST_RECORD_SIZE + persist->next, persist->record[persist->next]);
+    if (++persist->next == PERSIST_RECORD_SIZE) {
+        persist->seq++;
+        persist->slot = persist->slot + 1 == persist->slots ? 0 : persist->slot + 1;
+    }
+}
+
+void TouchSlider::tickDrift() {
+    uint32_t now = clockMillis();
+    if (touchedMask != drift->mask) {
+        drift->mask = touchedMask;
+        drift->changeMillis = now;
+        return;
+    }
+
+    // Recalibrate the lowest-numbered stuck sensor. If there are others, they go on the following ticks.
+    if (touchedMask != 0) {
+        if (now - drift->changeMillis >= drift->stuckMs) {
+            uint8_t s = 0;
+            while ((touchedMask & ((tsl_mask_t)1 << s)) == 0) {
+                s++;
+            }
+            recalibrate(s);
+            drift->mask = touchedMask;
+        }
+        return;
+    }
+
+    // Untouched: do the next step of the routine recalibration, if one is due
+    if (drift->recalMs == 0 || now - drift->changeMillis < DRIFT_IDLE_MS || flickVelocity != 0) {
+        return;
+    }
+    if (drift->pad >= nSensors) {
+        if (now - drift->sweepMillis < drift->recalMs) {
+            return;
+        }
+        drift->pad = 0;
+    }
+    recalibrate(drift->pad);
+    if (++drift->pad >= nSensors) {
+        drift->pad = TSL_NO_PAD;
+        drift->sweepMillis = now;
+    }
+}
+
+void TouchSlider::resetDrift() {
+    if (drift == nullptr) {
+        return;
+    }
+    drift->mask = touchedMask;
+    drift->changeMillis = clockMillis();
+    drift->pad = TSL_NO_PAD;
+}
+
+void TouchSlider::recalibrate(uint8_t sensorS) {
+    sensor[sensorS].end();
+    sensor[sensorS].begin();
+    tsl_mask_t bit = (tsl_mask_t)1 << sensorS;
+    if ((touchedMask & bit) == 0) {
+        return;
+    }
+
+    // Forget the touch without the slide logic; the finger didn't really go anywhere
+    sensorTouched[sensorS] = false;
+    touchedMask &= ~bit;
+    nTouched--;
+    if (repeat && sensorS == repeat->pad) {
+        repeat->dir = 0;
+    }
+    if (nTouched == 0) {
+        restPad = sensorS;
+        onIdle();
+    }
+}
+
+void TouchSlider::noteTelemetry(uint32_t now) {
+    telemetry->changeMicros = now;
+    if (telemetry->changes < 255) {
+        telemetry->changes++;
+    }
+}
+
+void TouchSlider::tickTelemetry() {
+    uint32_t now = clockMillis();
+    if (telemetry->changes == 0 && (telemetry->period == 0 || now - telemetry->frameMillis < telemetry->period)) {
+        return;
+    }
+    if (telemetry->port->availableForWrite() < TSL_TELEMETRY_FRAME_SIZE) {
+        return;
+    }
+    uint8_t frame[TSL_TELEMETRY_FRAME_SIZE];
+    uint32_t field[4] = {telemetry->changeMicros, clockMicros(), (uint32_t)(int32_t)value, touchedMask};
+    frame[0] = TSL_TELEMETRY_SYNC;
+    frame[1] = telemetry->id;
+    frame[2] = nSensors;
+    frame[3] = telemetry->seq++;
+    frame[4] = telemetry->changes;
+    for (uint8_t f = 0; f < 4; f++) {
+        for (uint8_t b = 0; b < 4; b++) {
+            frame[5 + f * 4 + b] = field[f] >> (b * 8);
+        }
+    }
+    uint8_t check = 0;
+    for (uint8_t b = 1; b < TSL_TELEMETRY_FRAME_SIZE - 1; b++) {
+        check ^= frame[b];
+    }
+    frame[TSL_TELEMETRY_FRAME_SIZE - 1] = check;
+    telemetry->port->write(frame, TSL_TELEMETRY_FRAME_SIZE);
+    telemetry->changes = 0;
+    telemetry->frameMillis = now;
+}
+
+void TouchSlider::seekDetent() {
+    while (detentIx < nDetents && detent[detentIx] <= value) {
+        detentIx++;
+    }
+    while (detentIx > 0 && detent[detentIx - 1] > value) {
+        detentIx--;
+    }
+}
+
+bool TouchSlider::atLimit(int32_t dir) {
+    if (clamped) {
+        return value == (dir > 0 ? maxValue : minValue);
+    }
+    return value == (dir > 0 ? TSL_VALUE_MAX : TSL_VALUE_MIN);
+}
+
+void TouchSlider::tickRepeat() {
+    uint32_t now = clockMillis();
+    if (now - repeat->lastMillis < (repeat->repeating ? repeat->interval : repeat->delayMs)) {
+        return;
+    }
+    if (repeat->repeating) {
+        uint16_t shorter = repeat->interval - repeat->interval / 8;
+        repeat->interval = shorter < repeat->minMs ? repeat->minMs : shorter;
+    } else {
+        repeat->interval = repeat->startMs;
+        repeat->repeating = true;
+    }
+    repeat->lastMillis = now;
+    stepValue(repeat->dir, repeat->pad, STEP_REPEAT);
+    if (atLimit(repeat->dir)) {
+        repeat->dir = 0;                        // Reached the end of the range
+    }
+}
+
+void TouchSlider::tickFlick() {
+    uint32_t now = clockMillis();
+    while (flickVelocity != 0 && now - flickMillis >= FLICK_PERIOD_MS) {
+        flickMillis += FLICK_PERIOD_MS;
+        flickAccum += flickVelocity;
+        int32_t steps = flickAccum / 256;
+        if (steps != 0) {
+            flickAccum -= steps * 256;
+            stepValue(steps, TSL_NO_PAD, STEP_FLICK);
+            if (atLimit(steps)) {
+                flickVelocity = 0;                      // Hit the end of the range
+                break;
+            }
+        }
+        flickVelocity = flickVelocity * flickDecay / 256;
+        if (flickVelocity < FLICK_STOP && flickVelocity > -FLICK_STOP) {
+            flickVelocity = 0;
+        }
+    }
+    if (flickVelocity == 0) {
+        notifyIdle();                                   // The flick is over, so the value is final
+    }
+}
+
+void TouchSlider::prepareOutput() {
+    if (!inService) {
+        return;                                 // begin() will call us again once value and its range are set
+    }
+    // Bring the span down to 16 bits, then give mapScale as many fraction bits as it can have without 
+    // mapValue()'s 32-bit arithmetic overflowing. Rounding mapScale up means maxValue maps to at least mapSpan, 
+    // which mapValue() clamps to exactly mapSpan.
+    uint32_t span = (uint32_t)maxValue - (uint32_t)minValue;
+    mapPreShift = 0;
+    while ((span >> mapPreShift) > 0xFFFF) {
+        mapPreShift++;
+    }
+    span >>= mapPreShift;
+    mapShift = 0;
+    mapScale = 0;
+    if (mapType != MAP_NONE && span != 0) {
+        for (mapShift = 31; mapShift > 0; mapShift--) {
+            uint64_t scale = (((uint64_t)mapSpan << mapShift) + span - 1) / span;
+            if (scale * span + ((uint64_t)1 << (mapShift - 1)) <= 0xFFFFFFFF) {
+                break;
+            }
+        }
+        mapScale = (((uint64_t)mapSpan << mapShift) + span - 1) / span;
+    }
+    if (sinkType != SINK_NONE) {
+        writeOutput();
+    }
+}
+
+uint16_t TouchSlider::mapValue() {
+    if (mapType == MAP_NONE) {
+        return (uint16_t)value;
+    }
+    // Unclamped, value can be outside minValue..maxValue; the map only covers the range
+    tsl_value_t v = value < minValue ? minValue : value > maxValue ? maxValue : value;
+    uint32_t offset = ((uint32_t)v - (uint32_t)minValue) >> mapPreShift;
+    uint32_t ix = (offset * mapScale + ((uint32_t)1 << mapShift >> 1)) >> mapShift;
+    uint16_t out = ix > mapSpan ? mapSpan : ix;
+    if (mapType == MAP_TABLE) {
+        return mapProgmem ? pgm_read_word(&mapTable[out]) : mapTable[out];
+    }
+    return mapOutMax >= mapOutMin ? mapOutMin + out : mapOutMin - out;
+}
+
+void TouchSlider::writeOutput() {
+    uint16_t out = mapValue();
+    switch (sinkType) {
+        case SINK_PWM:
+            analogWrite(sink.pin, out);
+            break;
+        case SINK_REG8:
+            *sink.reg8 = (uint8_t)out;
+            break;
+        case SINK_REG16:
+            *sink.reg16 = out;
+            break;
+        default:
+            break;
+    }
+}
+
+void TouchSlider::tickGesture() {
+    uint32_t elapsed = clockMillis() - gesture->startMillis;
+    if (gesture->state == GESTURE_DOWN && elapsed >= HOLD_MS) {
+        gesture->state = GESTURE_NONE;
+        noteEarlierTap();
+        gesture->handler(TSL_HOLD, gesture->pad, gesture->client);
+    } else if (gesture->state == GESTURE_TAPPED && elapsed > DOUBLE_TAP_MS) {
+        gesture->state = GESTURE_IDLE;
+        gesture->handler(TSL_TAP, gesture->pad, gesture->client);
+    }
+}
+
+void TouchSlider::gestureTouched(uint8_t sensorS) {
+    if (nTouched != 1) {
+        // A second sensor; if it's a slide, noteStep() will see to it. Otherwise it's the same finger.
+        return;
+    }
+    if (gesture->state == GESTURE_TAPPED && 
+        (sensorS != gesture->pad || clockMillis() - gesture->startMillis > DOUBLE_TAP_MS)) {
+        // A touch elsewhere, or too late, means the earlier tap was just a tap
+        gesture->handler(TSL_TAP, gesture->pad, gesture->client);
+        gesture->state = GESTURE_IDLE;
+    }
+    gesture->secondTap = gesture->state == GESTURE_TAPPED;
+    gesture->state = GESTURE_DOWN;
+    gesture->pad = sensorS;
+    gesture->startMillis = clockMillis();
+}
+
+void TouchSlider::gestureReleased() {
+    uint32_t now = clockMillis();
+    if (gesture->state != GESTURE_DOWN || now - gesture->startMillis > TAP_MAX_MS) {
+        if (gesture->state == GESTURE_DOWN) {
+            noteEarlierTap();                   // Too long for a tap
+        }
+        gesture->state = GESTURE_IDLE;
+        return;
+    }
+    if (gesture->secondTap) {
+        gesture->state = GESTURE_IDLE;
+        gesture->handler(TSL_DOUBLE_TAP, gesture->pad, gesture->client);
+        return;
+    }
+    gesture->state = GESTURE_TAPPED;
+    gesture->startMillis = now;
+}
+
+void TouchSlider::noteEarlierTap() {
+    if (gesture->secondTap) {
+        gesture->secondTap = false;
+        gesture->handler(TSL_TAP, gesture->pad, gesture->client);
+    }
+}
+
+bool TouchSlider::contactOk() {
+    // Find the runs of adjacent touched sensors: where each starts and ends, in half-sensor units, and how many
+    tsl_mask_t m = touchedMask;
+    tsl_mask_t wrap = (tsl_mask_t)1 << (nSensors - 1);
+    uint8_t nRuns = 0;
+    uint8_t runCenter[2];
+    uint8_t runLen = 0;
+    bool longRun = false;
+    for (uint8_t s = 0; s <= nSensors; s++) {
+        bool touched = s < nSensors && (m & ((tsl_mask_t)1 << s));
+        if (touched) {
+            runLen++;
+        } else if (runLen != 0) {
+            if (nRuns < 2) {
+                runCenter[nRuns] = 2 * s - runLen - 1;      // first + last
+            }
+            nRuns++;
+            longRun = longRun || runLen > 2;
+            runLen = 0;
+        }
+    }
+    // On a wheel, the last and first sensors are adjacent, so a finger there makes two runs of one
+    bool single = nRuns <= 1 || (circular && nRuns == 2 && (m & 1) && (m & wrap) && (m & ~(wrap | 1)) == 0);
+    single = single && !longRun;
+
+    bool wasMulti = multiContact;
+    multiContact = !single;
+
+    // Report two fingers
+    uint8_t newSpread = !single && nRuns == 2 && !longRun ? runCenter[1] - runCenter[0] : 0;
+    if (twoFingerHandler && newSpread != 0 && newSpread != spread) {
+        twoFingerHandler(newSpread, spread == 0 ? 0 : (int8_t)(newSpread - spread), twoFingerClientData);
+    }
+    spread = newSpread;
+
+    // Suppress slides on the way into and out of multi-finger contact, and during it
+    return !(wasMulti || multiContact);
+}
+
+bool TouchSlider::acceptStep(int8_t dir) {
+    if (lockDir == 0 || dir == lockDir) {
+        lockDir = dir;
+        if (revPending == 0) {
+            return true;
+        }
+        revPending--;                           // Undoes a suppressed reverse step; it was jitter
+        return false;
+    }
+
+    // A reverse step. Suppress it unless the reversal has persisted long enough.
+    uint32_t now = clockMillis();
+    if (revPending == 0) {
+        revMillis = now;
+    }
+    revPending++;
+    if (revPending >= revEdges || (revMs != 0 && now - revMillis >= revMs)) {
+        lockDir = dir;
+        revPending = 0;
+        return true;
+    }
+    return false;
+}
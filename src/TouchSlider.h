@@ -45,20 +45,144 @@
  * specify the maximum and minimum values the TouchSlider can be set to, together with its initial value and the 
  * increment by which it steps.
  * 
+ * TouchSlider values are 32-bit signed integers by default. If all your TouchSliders' values fit in a narrower 
+ * type, build with TSL_VALUE_TYPE defined as int8_t, uint8_t, int16_t or uint16_t (e.g., with build_flags = -D 
+ * TSL_VALUE_TYPE=uint8_t in platformio.ini). The type is called tsl_value_t in the library's interfaces. It's a 
+ * build-wide setting, not a per-TouchSlider one: every TouchSlider in the sketch, and every TouchPad2D axis, gets 
+ * the same type, so it has to be wide enough for the widest of them. It narrows the value, its range, the step 
+ * arithmetic (clamping and detents) and the handler parameters, which, with the 64-bit arithmetic of the default 
+ * type gone, can save time and flash on 8-bit MPUs. It doesn't narrow anything that isn't a value: timekeeping, 
+ * event deltas and velocities, takeDelta(), fractional increments, the wheel functions, output mapping, 
+ * persistence records and telemetry stay as they are. No numbers for the savings are published; how much it 
+ * saves depends on which features the sketch uses, so compare the size report of a build with and without it.
+ * 
  * Because TouchSlider is built on TouchSensor, you'll need to call TouchSensor::run() in loop(). Each call 
  * updates the state of all the TouchSensors that make up the TouchSlider, so call it a lot. I've worked hard to 
  * minimize the overhead when nothing's going on, so call it a lot to keep the TouchSlider responsive.
  * 
  * At any point, you can query the current value of your TouchSlider by calling its getValue() member function.
  * 
+ * If your loop() would rather poll than be called back, use takeDelta(). Like reading a quadrature encoder, it 
+ * returns the net change since it was last called. With setDeltaUnclamped(true) it counts every step, even ones 
+ * lost because the value is pinned at the end of its range.
+ * 
  * Alternatively (or in addition) you can call the setChangeHandler() member function to register an on-change 
  * callback function. Once you do this, the function you registered will be called whenever the value of the 
  * TouchSlider changes. Typically, registering an on-change callback is done in setup().
  * 
+ * If you need more than the new value -- the size and direction of the change, which sensor it happened on, 
+ * when it happened, how fast the value is changing or the mapped output -- register a handler with 
+ * setEventHandler() instead. It gets a tsl_event_t describing the change.
+ * 
+ * If more than one part of your sketch needs to know about changes, use subscribe() to register up to 
+ * MAX_SUBSCRIBERS (normally 4) more callback functions. Each subscriber comes with a filter that says which 
+ * changes it wants to hear about: every change, every Nth change, or just the final value once the finger has 
+ * been lifted.
+ * 
+ * If all a change handler would do is set a PWM duty cycle or a register, bind the TouchSlider to it instead with 
+ * bindPwm() or bindRegister(). The TouchSlider then writes the new value to the output itself. With 
+ * setOutputRange() or setOutputTable() you can map the value onto a different output range or through a lookup 
+ * table first.
+ * 
+ * For perceptual controls like volume or brightness, pass begin() a tsl_curve_t instead of a value range. begin() 
+ * builds a lookup table for the curve (logarithmic, exponential or power) once, up front. The TouchSlider's value 
+ * then steps through the points on the curve, and getOutput() -- and any bound output, and the output member of 
+ * the tsl_event_t an event handler gets -- reports the curve's value at the current point.
+ * 
+ * Some TouchSlider features, such as flick scrolling, are driven by the passage of time rather than by finger 
+ * movement. If you use any of them, call TouchSlider::run() in loop() instead of TouchSensor::run(). It runs the 
+ * TouchSensors and then does the time-driven work for every TouchSlider that's in service. To enable flick 
+ * scrolling, call setFlick(). With it enabled, lifting your finger right after a fast slide makes the value keep 
+ * going in the same direction, slowing as it goes, until it stops or you touch the slider again.
+ * 
+ * If your sketch has several TouchSliders, a TouchSliderGroup (in TouchSliderGroup.h) can handle them as one. 
+ * Each TouchSlider's sensor state changes are routed straight to it through a table indexed by pin, and a single 
+ * group change handler is told which slider changed and its new value. Put the TouchSliders into service, add() 
+ * them to the group and call the group's run() in loop().
+ * 
+ * For a two-dimensional touchpad, a TouchPad2D (in TouchPad2D.h) combines a row of column sensors and a column of 
+ * row sensors -- typically laid out as an interleaved diamond pattern -- into an X/Y position. Each axis is a 
+ * TouchSlider and can report either a relative coordinate, moved by slides like a laptop touchpad, or an absolute 
+ * one, where the finger is. A single change handler gets both coordinates, and the TouchPad2D's run() scans all 
+ * the sensors in one sweep.
+ * 
+ * Besides slides, a TouchSlider can recognize taps, double-taps and holds (long-presses) on its sensors -- handy 
+ * for nudging the value by tapping an end, say, or resetting it with a long-press. Register a gesture handler 
+ * with setGestureHandler() to turn recognition on. The handler is told which gesture was made and on which 
+ * sensor.
+ * 
+ * On a linear TouchSlider, setAutoRepeat() lets one slide cover a large range. When a slide ends with the finger 
+ * resting on the last (or first) sensor, the value keeps stepping up (or down) on its own, faster and faster, 
+ * until the finger moves or the end of the range is reached.
+ * 
+ * To keep operators from overshooting important values -- zero or center, say -- give the TouchSlider detents 
+ * with setDetents(). A slide stops at each detent and takes a few extra steps to move off it.
+ * 
+ * To have a TouchSlider's value survive power cycles, call setPersistence() before begin(). The value is saved in 
+ * EEPROM once the TouchSlider has been idle for a while, not on every change. The write is done a byte at a time, 
+ * as the EEPROM becomes ready, so run() never waits for it. Successive saves rotate through a ring of records to 
+ * spread the wear. begin() picks up the newest saved value.
+ * 
+ * The slide logic assumes a single finger. If palms or more than one finger are likely, turn on palm rejection 
+ * with setPalmRejection(). The value then stays put whenever more than a single finger's worth of sensors is 
+ * being touched. To do something with two fingers, register a two-finger handler with setTwoFingerHandler(). It's 
+ * told the distance between the fingers as they spread or pinch. If the TouchSlider is a wheel, call 
+ * setCircular(true) so a finger on its last and first sensors counts as one finger.
+ * 
+ * A finger resting on the boundary between two sensors can make the value jitter up and down. 
+ * setReversalHysteresis() stops that: once the value is moving one way, a reversal only takes effect after it has 
+ * persisted for a given number of steps or a given time.
+ * 
+ * For finer control than a whole unit per step, use setFractionalIncrement(), e.g., 
+ * setFractionalIncrement(tslQ16(0.25)) for a quarter unit per step. Fractions accumulate in fixed point, with no 
+ * floating point math, and handlers are only called when the value actually changes.
+ * 
+ * A circular TouchSlider -- a wheel -- can also report where the finger is (getWheelPosition() or 
+ * getWheelAngle()), how many times it has gone around (getRevolutions()) and how fast it's going 
+ * (getWheelVelocity()). Turn off clamping with setClamped(false) to use a wheel as an unbounded jog dial.
+ * 
  * If you don't need a TouchSlider for a while, call its end() member function. This will cause its value to stop 
  * changing and, with no value changes, there will be no on-change callbacks made. If you need the TouchSlider 
  * again, call begin(). Value changes and on-change callbacks will resume.
  * 
+ * For devices that run for weeks at a time, call setDriftRecovery(). Temperature and humidity slowly change the 
+ * sensors' capacitance, and a sensor can end up stuck "touched", freezing the slider. With drift recovery on, a 
+ * sensor that stays touched far longer than any finger would is recalibrated and the phantom touch forgotten, 
+ * and, while the slider is idle, all its sensors are periodically recalibrated, one per call to run(), so they 
+ * follow the drift.
+ * 
+ * To catch wiring faults before they show up as erratic behavior, call selfTest() before begin(), or 
+ * setSelfTest(true) to have begin() do it and fail if something's wrong. In a few milliseconds it measures every 
+ * sensor's discharge time through its ground resistor, all at once, and checks each sensor against the others. 
+ * It sets a bitmask of the sensors with faults and, if you pass it a tsl_pad_diag_t, fills that in with which 
+ * faults -- shorted, open, bridged to another sensor or crosstalk with another sensor -- and each sensor's measured 
+ * discharge time. If the TouchSlider is in service, selfTest() doesn't test and returns false instead, so a test 
+ * that didn't happen can't be mistaken for one that passed, or for one that found every sensor faulty.
+ * 
+ * To watch a TouchSlider at work in the field, call setTelemetry() with a serial port. The TouchSlider then sends 
+ * its state -- touched sensors, value and timestamps -- as small binary frames whenever something changes, and, 
+ * optionally, periodically. Frames are only written when the port's transmit buffer has room for them, so, unlike 
+ * printing text, telemetry never holds up the sketch.
+ * 
+ * Until you turn them on, gestures, auto-repeat, persistence, drift recovery and telemetry cost a TouchSlider 
+ * just a pointer apiece. Each keeps its state in storage your sketch provides -- a 
+ * TouchSlider::tsl_gesture_stg_t, tsl_repeat_stg_t, tsl_persist_stg_t, tsl_drift_stg_t or tsl_telemetry_stg_t, 
+ * declared alongside the TouchSlider -- and passes to setGestureHandler(), setAutoRepeat(), setPersistence(), 
+ * setDriftRecovery() or setTelemetry(). Similarly, every TouchSlider has room for MAX_SUBSCRIBERS subscribers; 
+ * build with MAX_SUBSCRIBERS defined as something else (0, say, if you never call subscribe()) to change that.
+ * 
+ * Every TouchSlider feature that depends on time gets it from a single clock, normally millis() and micros(). A 
+ * host build can call TouchSlider::setClock() to substitute a virtual clock, so timing behavior can be simulated 
+ * faster than real time and with the same results every run.
+ * 
+ * To change which pins make up a TouchSlider -- say, because a modal panel reuses some of its sensors -- call 
+ * reconfigure(). It rebuilds the TouchSensors in place and keeps the TouchSlider's value and settings.
+ * 
+ * If your sketch creates and retires TouchSliders as it goes but can't use the heap, get them from a 
+ * TouchSliderPool (in TouchSliderPool.h) instead. The pool's size is set at compile time; acquire() constructs a 
+ * TouchSlider in the pool's storage and release() destroys it. highWater() reports the most that were ever in use 
+ * at once.
+ * 
  * If you no longer require your TouchSlider at all, call its dtor.
  * 
  * How It Works
@@ -93,6 +217,9 @@
  * time. What if that's not true? Well, the analysis is a bit harder, but things work out. Exercise left to the 
  * reader.
  * 
+ * If you'd rather not leave it to chance, turn on palm rejection. Then slides are only counted while the touched 
+ * sensors look like a single finger: one sensor, or two adjacent ones.
+ * 
  *****
  * 
  * TouchSlider V1.0.2, November 2025
@@ -129,8 +256,98 @@
 
 constexpr int32_t MAX_MAX_32 = 0x7FFFFFFF;              // The biggest 32-bit signed integer
 constexpr int32_t MIN_MIN_32 = 0x80000000;              // The smallest 32-bit signed integer
+
+#ifndef TSL_VALUE_TYPE
+    #define TSL_VALUE_TYPE int32_t                      // The type of TouchSlider values. To use less time and 
+#endif                                                  //   space on 8-bit MPUs, build with -D TSL_VALUE_TYPE= 
+                                                        //   int8_t, uint8_t, int16_t or uint16_t. It applies to 
+                                                        //   every TouchSlider in the build.
+
+// For each possible value type, its range and the narrowest signed type that holds the sum of two of them
+template <typename T> struct tsl_value_traits;
+template <> struct tsl_value_traits<int8_t> {
+    using wide_t = int16_t;
+    static constexpr int8_t minimum() { return INT8_MIN; }
+    static constexpr int8_t maximum() { return INT8_MAX; }
+};
+template <> struct tsl_value_traits<uint8_t> {
+    using wide_t = int16_t;
+    static constexpr uint8_t minimum() { return 0; }
+    static constexpr uint8_t maximum() { return UINT8_MAX; }
+};
+template <> struct tsl_value_traits<int16_t> {
+    using wide_t = int32_t;
+    static constexpr int16_t minimum() { return INT16_MIN; }
+    static constexpr int16_t maximum() { return INT16_MAX; }
+};
+template <> struct tsl_value_traits<uint16_t> {
+    using wide_t = int32_t;
+    static constexpr uint16_t minimum() { return 0; }
+    static constexpr uint16_t maximum() { return UINT16_MAX; }
+};
+template <> struct tsl_value_traits<int32_t> {
+    using wide_t = int64_t;
+    static constexpr int32_t minimum() { return MIN_MIN_32; }
+    static constexpr int32_t maximum() { return MAX_MAX_32; }
+};
+
+using tsl_value_t = TSL_VALUE_TYPE;                     // The type of TouchSlider values
+using tsl_wide_t = tsl_value_traits<tsl_value_t>::wide_t;
+                                                        // Wide enough for the sum of two values
+constexpr tsl_value_t TSL_VALUE_MIN = tsl_value_traits<tsl_value_t>::minimum();
+                                                        // The smallest possible value
+constexpr tsl_value_t TSL_VALUE_MAX = tsl_value_traits<tsl_value_t>::maximum();
+                                                        // The biggest possible value
 constexpr uint8_t MAX_SENSORS = 6;                      // The maximum number of sensors we might have
-                                                        //   Can be set to as many as NUM_DIGITAL_PINS
+                                                        //   Can be set to as many as NUM_DIGITAL_PINS or 32,
+                                                        //   whichever is less
+static_assert(MAX_SENSORS <= 32, "MAX_SENSORS must be 32 or less");
+#ifndef MAX_SUBSCRIBERS
+    #define MAX_SUBSCRIBERS 4                           // The maximum number of subscribers a TouchSlider can have. 
+#endif                                                  //   Each takes room in every TouchSlider, so build with, e.g., 
+                                                        //   -D MAX_SUBSCRIBERS=0 if you don't use subscribe().
+constexpr uint8_t FLICK_PERIOD_MS = 16;                 // millis() between steps of flick momentum
+constexpr uint8_t FLICK_LIFT_MS = 60;                   // Max millis() between last slide step and lift for a flick
+constexpr int16_t FLICK_STOP = 16;                      // Flick stops when speed falls below this (1/256 steps/period)
+constexpr uint8_t TSL_NO_PAD = 0xFF;                    // tsl_event_t.pad for changes that didn't come from a sensor
+constexpr uint16_t TAP_MAX_MS = 250;                    // Longest touch that counts as a tap
+constexpr uint16_t DOUBLE_TAP_MS = 300;                 // Longest gap between the taps of a double-tap
+constexpr uint16_t HOLD_MS = 800;                       // Shortest touch that counts as a hold (long-press)
+constexpr uint8_t PERSIST_RECORD_SIZE = 6;              // EEPROM bytes per persisted value record
+constexpr uint16_t DRIFT_IDLE_MS = 1000;                // Untouched time before a routine recalibration can start
+constexpr uint8_t SELF_TEST_SAMPLES = 8;                // Discharge time measurements per sensor in selfTest()
+constexpr uint8_t SELF_TEST_CHARGE_US = 10;             // Time selfTest() drives the sensors HIGH to charge them
+constexpr uint8_t SELF_TEST_DISCHARGE_US = 10;          // Time selfTest() drives the sensors LOW to discharge them
+constexpr uint8_t SELF_TEST_SETTLE_US = 50;             // Time selfTest() gives a bridge test to settle
+constexpr uint8_t SELF_TEST_COUPLE_US = 2;              // Time selfTest() waits before reading a crosstalk test
+constexpr uint8_t SELF_TEST_MAX_POLLS = 255;            // Polls before selfTest() gives up on a sensor discharging
+constexpr uint8_t TSL_PAD_SHORTED = 0x01;               // A selfTest() fault: shorted to ground or the supply
+constexpr uint8_t TSL_PAD_OPEN = 0x02;                  // A selfTest() fault: not connected to its pad or its
+                                                        //   ground resistor
+constexpr uint8_t TSL_PAD_BRIDGED = 0x04;               // A selfTest() fault: shorted to another sensor
+constexpr uint8_t TSL_PAD_CROSSTALK = 0x08;             // A selfTest() fault: strongly coupled to another sensor
+constexpr uint8_t TSL_PAD_UNTESTED = 0x10;              // Not a fault: selfTest() couldn't test the sensor
+constexpr uint8_t TSL_TELEMETRY_SYNC = 0xA5;            // The first byte of each telemetry frame
+constexpr uint8_t TSL_TELEMETRY_FRAME_SIZE = 22;        // The number of bytes in a telemetry frame
+
+/**
+ * @brief   Convert a number to Q16.16 fixed point, e.g., for setFractionalIncrement(). When x is a constant, the 
+ *          conversion is done by the compiler, so no floating point math happens at run time.
+ * 
+ * @param x         The number to convert
+ * @return int32_t  x in Q16.16
+ */
+constexpr int32_t tslQ16(double x) {
+    return (int32_t)(x * 65536.0 + (x < 0 ? -0.5 : 0.5));
+}
+
+// The smallest unsigned type with a bit for each of MAX_SENSORS sensors
+template <bool fits8, bool fits16> struct tsl_mask_sel { using type = uint32_t; };
+template <bool fits16> struct tsl_mask_sel<true, fits16> { using type = uint8_t; };
+template <> struct tsl_mask_sel<false, true> { using type = uint16_t; };
+using tsl_mask_t = tsl_mask_sel<MAX_SENSORS <= 8, MAX_SENSORS <= 16>::type;
+
+class TouchSliderGroup;
 
 class TouchSlider {
 public:
@@ -154,17 +371,373 @@ public:
      * @return true     The TouchSlider was successfully started
      * @return false    The TouchSlider was not successfully started
      */
-    bool begin(int32_t minV, int32_t maxV, int32_t curV = 0, int32_t inc = 1);
+    bool begin(tsl_value_t minV, tsl_value_t maxV, tsl_value_t curV = 0, tsl_value_t inc = 1);
     
     /**
      * @brief   Put the TouchSlider into service with default values. Equivalent to 
-     *          begin(MIN_MIN_32, 0, MAX_MAX_32, 1);
+     *          begin(TSL_VALUE_MIN, TSL_VALUE_MAX, 0, 1);
      * 
      * @return true 
      * @return false 
      */
     bool begin();
 
+    /**
+     * @brief   The shapes of curve a TouchSlider's output can follow. x runs from 0 to 1 over the curve and the 
+     *          output from outMin (at x = 0) to outMax (at x = 1).
+     * 
+     *          TSL_CURVE_LINEAR    Straight line. k is ignored.
+     *          TSL_CURVE_LOG       log(1 + k * x) / log(1 + k). Fast at first, then slower. k > 0.
+     *          TSL_CURVE_EXP       (exp(k * x) - 1) / (exp(k) - 1). Slow at first, then faster -- what eyes and 
+     *                              ears expect of brightness and volume. k > 0.
+     *          TSL_CURVE_POWER     x ** k. k = 2.2 gives the usual gamma curve. k > 0.
+     * 
+     *          For any other shape, build the table yourself and pass it to setOutputTable().
+     */
+    enum tsl_curve_shape_t : uint8_t {TSL_CURVE_LINEAR, TSL_CURVE_LOG, TSL_CURVE_EXP, TSL_CURVE_POWER};
+
+    /**
+     * @brief   A curve descriptor; what's passed to begin() to make a TouchSlider with a non-linear output.
+     * 
+     * @param   shape       The shape of the curve.
+     * @param   k           The shape's parameter.
+     * @param   outMin      The output at the start of the curve.
+     * @param   outMax      The output at the end of the curve.
+     * @param   table       RAM, provided by the client, in which begin() builds the curve's lookup table. It 
+     *                      must stay around as long as the TouchSlider uses it.
+     * @param   len         The number of entries in table -- the number of points on the curve. len >= 2, and 
+     *                      len - 1 must fit in tsl_value_t.
+     */
+    struct tsl_curve_t {
+        tsl_curve_shape_t shape;
+        float k;
+        uint16_t outMin;
+        uint16_t outMax;
+        uint16_t* table;
+        uint16_t len;
+    };
+
+    /**
+     * @brief   Put the TouchSlider into service with its output following a curve. The curve's lookup table is 
+     *          built here, once, so the floating point math isn't done on every change. The TouchSlider's value 
+     *          is the index of the current point on the curve (0 .. curve.len - 1, stepping by 1) and getOutput(), 
+     *          any bound output and the output member of the tsl_event_t passed to an event handler report the 
+     *          curve's value at that point. The change handler and subscribers get the index.
+     * 
+     * @param curve     The curve descriptor
+     * @param curIndex  The current (initial) index into the curve
+     * @return true     The TouchSlider was successfully started
+     * @return false    The TouchSlider was not successfully started, e.g., because k isn't > 0 for a curve that 
+     *                  needs it. Its output mapping, if any, is left as it was. curve.table is only rebuilt once 
+     *                  all the checks have passed, so it's untouched unless the TouchSensors fail to start.
+     */
+    bool begin(const tsl_curve_t& curve, uint16_t curIndex = 0);
+
+    /**
+     * @brief   Update the state of all the TouchSensors and then of all the TouchSliders that are in service. Call 
+     *          this instead of TouchSensor::run() in loop() if you use any of the TouchSlider features that are 
+     *          driven by the passage of time, such as flick. Like TouchSensor::run(), call it a lot.
+     * 
+     */
+    static void run();
+
+    /**
+     * @brief   The type of a clock function: one that returns the time, like millis() or micros() do.
+     * 
+     */
+    using tsl_clock_t = uint32_t (*)();
+
+    /**
+     * @brief   Set the clock all TouchSliders use. Every time-dependent feature -- flick, gestures, auto-repeat, 
+     *          hysteresis, persistence, drift recovery, telemetry, timestamps and velocities -- gets the time 
+     *          from it. Normally that's millis() and micros(), but a host build can supply virtual time instead, 
+     *          to run simulations faster than real time and reproducibly. The two functions must keep time 
+     *          together: clockMicros() / 1000 should track clockMillis().
+     * 
+     * @param millisFn  Returns the time in milliseconds; nullptr for millis()
+     * @param microsFn  Returns the time in microseconds; nullptr for micros()
+     */
+    static void setClock(tsl_clock_t millisFn, tsl_clock_t microsFn);
+
+    /**
+     * @brief   Configure "flick" scrolling. When flick is enabled and the finger is lifted right after a fast slide, 
+     *          the TouchSlider keeps stepping its value in the same direction, slowing down as it goes, until it 
+     *          stops, hits minValue or maxValue, or a sensor is touched again. Requires TouchSlider::run().
+     * 
+     * @param minSpeed  The slide speed, in sensor-to-sensor steps per second, at or above which lifting the finger 
+     *                  starts a flick. 0 (the default) disables flick.
+     * @param decay     How quickly a flick slows down. Every FLICK_PERIOD_MS, its speed is multiplied by 
+     *                  decay / 256.
+     */
+    void setFlick(uint16_t minSpeed, uint8_t decay = 240);
+
+    /**
+     * @brief   The gestures, other than slides, that a TouchSlider can recognize. All of them are made with one 
+     *          finger that doesn't slide.
+     * 
+     *          TSL_TAP         A touch lasting at most TAP_MAX_MS, not followed by another within DOUBLE_TAP_MS.
+     *          TSL_DOUBLE_TAP  Two taps on the same sensor with at most DOUBLE_TAP_MS between them.
+     *          TSL_HOLD        A touch lasting at least HOLD_MS. Reported as soon as HOLD_MS has passed.
+     */
+    enum tsl_gesture_t : uint8_t {TSL_TAP, TSL_DOUBLE_TAP, TSL_HOLD};
+
+    /**
+     * @brief   The type a client-provided "gesture handler" function must have.
+     * 
+     * @param   gesture     The gesture that was recognized.
+     * @param   pad         The index (0 .. pCount - 1) of the sensor on which it was made.
+     * @param   client      The value the client passed when the gesture handler was registered.
+     */
+    using tsl_gesture_handler_t = void (*)(tsl_gesture_t gesture, uint8_t pad, void* client);
+
+    /**
+     * @brief   The state of gesture recognition. The client provides one to setGestureHandler(); its contents are 
+     *          the TouchSlider's business.
+     */
+    class tsl_gesture_stg_t;
+
+    /**
+     * @brief   Set the gestureHandler -- the function that will be called when a tap, double-tap or hold is 
+     *          recognized. Gesture recognition is on only while a gestureHandler is set; pass nullptr to turn it 
+     *          off. Requires TouchSlider::run().
+     * 
+     * @param stg       Where to keep the state of gesture recognition. It must stay around as long as recognition 
+     *                  is on.
+     * @param handler   The function to call
+     * @param client    Client provided value. Whatever it is, it will be passed to the function when it's called.
+     */
+    void setGestureHandler(tsl_gesture_stg_t* stg, tsl_gesture_handler_t handler, void* client);
+
+    /**
+     * @brief   The state of auto-repeat, provided by the client to setAutoRepeat().
+     */
+    class tsl_repeat_stg_t;
+
+    /**
+     * @brief   Configure hold-at-end auto-repeat, for linear TouchSliders. When a slide up ends with the finger 
+     *          resting on the last sensor, and it stays there for delayMs, the value starts stepping up on its own, 
+     *          faster and faster, until maxValue is reached or the finger moves. Likewise for a slide down that 
+     *          ends on the first sensor, toward minValue. A circular TouchSlider has no ends, so it never 
+     *          auto-repeats. Requires TouchSlider::run().
+     * 
+     * @param stg       Where to keep the state of auto-repeat, for as long as it's enabled; nullptr disables it.
+     * @param delayMs   How long the finger must rest on the end sensor before repeating starts. 0 disables 
+     *                  auto-repeat.
+     * @param startMs   The interval between the first two repeats. 0 disables auto-repeat.
+     * @param minMs     The shortest interval between repeats. Each interval is 1/8 shorter than the one before 
+     *                  until this is reached. 0 is taken as 1.
+     */
+    void setAutoRepeat(tsl_repeat_stg_t* stg, uint16_t delayMs, uint16_t startMs = 200, uint16_t minMs = 20);
+
+    /**
+     * @brief   Configure detents -- values where the TouchSlider "sticks". A step that would carry the value past a 
+     *          detent stops at the detent instead, and the next hold steps away from it are absorbed before the 
+     *          value moves on. The table isn't copied, so it must stay around as long as it's in use. The detent 
+     *          nearest the value is tracked as the value changes, so the cost per step doesn't depend on how many 
+     *          detents there are.
+     * 
+     * @param d         The detent values, in ascending order, without duplicates
+     * @param count     The number of entries in d. 0 turns detents off.
+     * @param hold      How many extra steps it takes to move off a detent.
+     * @return true     The detents were accepted
+     * @return false    The detents were not accepted because d isn't in ascending order
+     */
+    bool setDetents(const tsl_value_t d[], uint8_t count, uint8_t hold = 2);
+
+    /**
+     * @brief   The state of persistence -- where the ring is and the record being written -- provided by the client 
+     *          to setPersistence().
+     */
+    class tsl_persist_stg_t;
+
+    /**
+     * @brief   Make the TouchSlider's value persist across power cycles by saving it in EEPROM. The value isn't 
+     *          written on every change. Instead, once the TouchSlider has been idle for idleMs, the value is 
+     *          written, a byte at a time, whenever the EEPROM is ready for it, so run() never waits on the EEPROM. 
+     *          Successive writes go to successive records in a ring of slots records, spreading the wear. Call 
+     *          this before begin(); begin() then starts with the saved value, if there is one and it's within 
+     *          minV..maxV, instead of curV. Requires TouchSlider::run().
+     * 
+     * @param stg       Where to keep the state of persistence, for as long as it's on; nullptr turns it off.
+     * @param base      The EEPROM address of the ring of records. 
+     * @param slots     The number of records in the ring. The ring uses slots * PERSIST_RECORD_SIZE bytes of 
+     *                  EEPROM. 2 <= slots <= 128. 0 turns persistence off.
+     * @param idleMs    How long the value must be unchanged, with the TouchSlider not being touched, before it's 
+     *                  saved.
+     * @return true     Persistence was configured
+     * @return false    Persistence was not configured; slots is out of range or the ring doesn't fit in EEPROM
+     */
+    bool setPersistence(tsl_persist_stg_t* stg, uint16_t base, uint8_t slots, uint16_t idleMs = 2000);
+
+    /**
+     * @brief   Turn palm rejection on or off. The slide logic assumes a single finger, touching one sensor or two 
+     *          adjacent ones. With palm rejection on, whenever anything else is touching the sensors -- a palm 
+     *          touching three or more, or two fingers touching sensors that aren't adjacent -- the TouchSlider's 
+     *          value doesn't change. Sliding resumes as soon as it's back to a single finger.
+     * 
+     * @param reject    True to turn palm rejection on, false (the default) to turn it off
+     */
+    void setPalmRejection(bool reject);
+
+    /**
+     * @brief   Say whether the TouchSlider is linear (the default) or circular -- a wheel, with its last sensor 
+     *          next to its first. Palm rejection and two-finger detection go by this: on a wheel, the last and 
+     *          first sensors touched together are one finger; on a linear TouchSlider, they're two.
+     * 
+     * @param circular  True for a wheel, false for a linear TouchSlider
+     */
+    void setCircular(bool circular);
+
+    /**
+     * @brief   The type a client-provided "two-finger handler" function must have.
+     * 
+     * @param   spread      The distance between the two fingers, in half-sensor units (e.g., 4 when the fingers 
+     *                      are each on a single sensor with one untouched sensor between them)
+     * @param   change      How much spread changed since the last call; > 0 for spreading, < 0 for pinching. 0 
+     *                      when the second finger first touches.
+     * @param   client      The value the client passed when the two-finger handler was registered.
+     */
+    using tsl_two_finger_handler_t = void (*)(uint8_t spread, int8_t change, void* client);
+
+    /**
+     * @brief   Set the twoFingerHandler -- the function that will be called when two fingers touch the 
+     *          TouchSlider and when the distance between them changes. Setting it also suppresses value changes 
+     *          while more than a single finger is touching, just as palm rejection does. Pass nullptr to turn 
+     *          two-finger detection off.
+     * 
+     * @param handler   The function to call
+     * @param client    Client provided value. Whatever it is, it will be passed to the function when it's called.
+     */
+    void setTwoFingerHandler(tsl_two_finger_handler_t handler, void* client);
+
+    /**
+     * @brief   Configure reversal hysteresis. A finger resting on the boundary between two sensors can make the 
+     *          value jitter up and down by one step. With hysteresis, once the value has started moving in one 
+     *          direction, a step in the other direction only takes effect after the reversal has persisted for 
+     *          edges steps or for ms milliseconds; steps back in the original direction cancel out the pending 
+     *          reversal instead of moving the value. The direction is forgotten when the finger is lifted.
+     * 
+     * @param edges     The number of consecutive reverse steps it takes to reverse. 0 or 1 turns hysteresis off.
+     * @param ms        If not 0, a reversal that has persisted this long takes effect even if it hasn't 
+     *                  persisted for edges steps.
+     */
+    void setReversalHysteresis(uint8_t edges, uint16_t ms = 0);
+
+    /**
+     * @brief   Set a fractional increment. Each sensor-to-sensor step then moves the value by incQ16 / 65536 
+     *          instead of by the increment passed to begin(). Fractions are accumulated, in fixed point, and the 
+     *          value changes (and handlers are called) only when a whole unit has accumulated. So, for example, 
+     *          tslQ16(0.25) takes four steps per unit. Sensitivity multipliers can be stacked by multiplying the 
+     *          Q16.16 factors before passing them in.
+     * 
+     * @param incQ16    The increment per step, in Q16.16 fixed point. 0 goes back to using the increment passed 
+     *                  to begin().
+     */
+    void setFractionalIncrement(int32_t incQ16);
+
+    /**
+     * @brief   The state of drift recovery, provided by the client to setDriftRecovery().
+     */
+    class tsl_drift_stg_t;
+
+    /**
+     * @brief   Configure drift recovery. Over hours, changes in temperature and humidity change the capacitance 
+     *          of the sensors, and a sensor can end up stuck "touched" with no finger on it. With drift recovery 
+     *          on, a sensor that stays touched for stuckMs with nothing else changing is taken to be stuck and is 
+     *          recalibrated: its TouchSensor is restarted, which makes it take its current reading as its new 
+     *          untouched level, and the stuck touch is forgotten without being treated as a slide. In addition, 
+     *          every recalMs, once the TouchSlider has been untouched for DRIFT_IDLE_MS, all its sensors are 
+     *          recalibrated so they track slow drift before they get stuck. Recalibration is done one sensor per 
+     *          call to run(), so no call to run() takes much longer than usual. Requires TouchSlider::run().
+     * 
+     * @param stg       Where to keep the state of drift recovery, for as long as it's on; nullptr turns it off.
+     * @param stuckMs   How long a sensor must stay touched, with nothing else changing, to count as stuck. 0 
+     *                  turns drift recovery off.
+     * @param recalMs   The interval between routine recalibrations of all the sensors. 0 to only recalibrate 
+     *                  stuck sensors.
+     */
+    void setDriftRecovery(tsl_drift_stg_t* stg, uint32_t stuckMs, uint32_t recalMs = 600000UL);
+
+    /**
+     * @brief   The per-sensor findings of selfTest(), for a client that wants more than which sensors have faults.
+     * 
+     * @param   fault       For each sensor, TSL_PAD_SHORTED, TSL_PAD_OPEN, TSL_PAD_BRIDGED and TSL_PAD_CROSSTALK 
+     *                      or-ed together; 0 if none; TSL_PAD_UNTESTED if the test couldn't be run.
+     * @param   baseline    For each sensor, the average number of polls it took to discharge through its ground 
+     *                      resistor -- its untouched baseline.
+     */
+    struct tsl_pad_diag_t {
+        uint8_t fault[MAX_SENSORS];
+        uint8_t baseline[MAX_SENSORS];
+    };
+
+    /**
+     * @brief   Test the sensors for wiring faults. The sensors are charged and then the time each takes to discharge 
+     *          through its ground resistor -- the RC time constant the TouchSensors rely on -- is measured, all the 
+     *          sensors at once, SELF_TEST_SAMPLES times. A sensor that reads HIGH while driven LOW, or LOW while 
+     *          driven HIGH, is shorted. One that never discharges has no path to ground -- a broken lead or a missing 
+     *          resistor -- so it's open. So, probably, is one that discharges in less than half the average time: it 
+     *          has little more than the pin's own capacitance, so it's not connected to its pad. Then each sensor in 
+     *          turn is driven while the others are watched: one that follows a sensor held LOW against its pull-up is 
+     *          bridged to it; one that goes HIGH within SELF_TEST_COUPLE_US of a sensor being driven HIGH has 
+     *          crosstalk with it. Normally the whole test takes a few milliseconds; SELF_TEST_MAX_POLLS bounds it, 
+     *          even when every sensor is stuck, to well under 50 ms with MAX_SENSORS sensors on a 16 MHz AVR. The 
+     *          TouchSlider must not be in service, so call this before begin() or after end(), or use setSelfTest() 
+     *          to have begin() do it.
+     * 
+     * @param faults        Set to the sensors with faults: bit s is set if sensor s has one; see diag for which. 0 
+     *                      if all is well. If the test wasn't run, every bit is set.
+     * @param diag          Where to put what was found on each sensor; nullptr if only faults is wanted
+     * @return true         The test was run
+     * @return false        The test wasn't run, because the TouchSlider is in service or its construction failed. 
+     *                      Every sensor in diag is marked TSL_PAD_UNTESTED.
+     */
+    bool selfTest(tsl_mask_t& faults, tsl_pad_diag_t* diag = nullptr);
+
+    /**
+     * @brief   Have begin() run selfTest() before putting the TouchSlider into service, and fail if it finds 
+     *          a fault. A begin() on a TouchSlider that's already in service doesn't test.
+     * 
+     * @param test      True to test in begin(), false (the default) not to
+     * @param diag      Where begin()'s selfTest() puts what it found on each sensor; nullptr if not wanted. It must 
+     *                  stay around while test is true.
+     */
+    void setSelfTest(bool test, tsl_pad_diag_t* diag = nullptr);
+
+    /**
+     * @brief   The state of telemetry, provided by the client to setTelemetry().
+     */
+    class tsl_telemetry_stg_t;
+
+    /**
+     * @brief   Turn binary telemetry on or off. With it on, the TouchSlider's state is sent to port, in fixed-size 
+     *          frames, whenever sensors are touched or released or the value changes, and, if periodMs isn't 0, 
+     *          every periodMs even if nothing has changed. A frame is only written when the port's transmit buffer 
+     *          has room for all of it, so run() never waits on the port. If changes come faster than frames can be 
+     *          sent, they're combined into the next frame that can be. Requires TouchSlider::run().
+     * 
+     *          A frame is TSL_TELEMETRY_FRAME_SIZE bytes, with multi-byte fields least significant byte first:
+     * 
+     *              0       TSL_TELEMETRY_SYNC
+     *              1       id, as passed here
+     *              2       The number of sensors
+     *              3       Sequence number; one more than the previous frame's
+     *              4       The number of changes combined into the frame (saturates at 255)
+     *              5..8    micros() at the latest of those changes
+     *              9..12   micros() when the frame was written
+     *              13..16  The value, as an int32_t
+     *              17..20  The touched mask; bit s is set if sensor s is being touched
+     *              21      Check byte: bytes 1..20 XOR-ed together
+     * 
+     * @param stg       Where to keep the state of telemetry, for as long as it's on; nullptr turns it off.
+     * @param port      The serial port to send to, already begin()-ed -- a HardwareSerial, or, on boards with 
+     *                  native USB like the Leonardo, Serial -- or anything else that's a Print and reports 
+     *                  availableForWrite(); nullptr to turn telemetry off
+     * @param id        An identifier for this TouchSlider, to tell its frames from those of others
+     * @param periodMs  The interval between frames sent when nothing has changed. 0 to only send on changes.
+     */
+    void setTelemetry(tsl_telemetry_stg_t* stg, Print* port, uint8_t id = 0, uint16_t periodMs = 0);
+
     /**
      * @brief   Take the TouchSlider out of service. A TouchSlider taken out of service can be put back into 
      *          service by calling begin().
@@ -174,7 +747,22 @@ public:
 
 
     /**
-     * @brief Destroy the Touch Slider object, freeing up all its resources
+     * @brief   Change the set of pins that make up the TouchSlider without destroying and reconstructing it. The 
+     *          TouchSensors are rebuilt in place, in the same storage, and the TouchSlider's value, range, handlers 
+     *          and other settings are kept. If the TouchSlider is in service, it stays in service. If it's a 
+     *          member of a TouchSliderGroup, add() it to the group again afterward.
+     * 
+     * @param p         The array of GPIO pin numbers, as for the ctor.
+     * @param pCount    The number of pins in p. 2 <= pCount <= MAX_SENSORS
+     * @return true     The TouchSlider was reconfigured
+     * @return false    The TouchSlider was not reconfigured because pCount is out of range (nothing changes), or 
+     *                  its new TouchSensors failed to start (it's now out of service)
+     */
+    bool reconfigure(uint8_t p[], uint8_t pCount);
+
+    /**
+     * @brief Destroy the Touch Slider object, freeing up all its resources. If it's a member of a 
+     *        TouchSliderGroup, it's removed from the group first.
      * 
      */
     ~TouchSlider();
@@ -187,7 +775,7 @@ public:
      * @param   sliderValue The slider's new value.
      * @param   client      The value the client passed when the change handler was registered.
      */
-    using tsl_handler_t = void (*)(int32_t sliderValue, void* client);
+    using tsl_handler_t = void (*)(tsl_value_t sliderValue, void* client);
 
     /**
      * @brief Set the changeHandler -- the function that will be called when the value of the TouchSlider changes.
@@ -197,12 +785,209 @@ public:
      */
     void setChangeHandler(tsl_handler_t handler, void* client);
 
+    /**
+     * @brief   The details of a change in the TouchSlider's value, passed to an event handler. It's filled in once, 
+     *          when the change happens, and passed by reference.
+     * 
+     * @param   value       The slider's new value.
+     * @param   delta       The signed amount by which the value changed, after clamping to minValue..maxValue.
+     * @param   pad         The index (0 .. pCount - 1) of the sensor whose state change caused the change, or 
+     *                      TSL_NO_PAD if the change didn't come from a sensor (e.g., it came from a flick).
+     * @param   micros      The value of micros() when the change happened.
+     * @param   velocity    The estimated rate of change, in value units per second. Positive when going up. For a 
+     *                      slide, it's based on the time between the latest two steps, so the first change of a 
+     *                      touch reports 0; for auto-repeat and flicks, it's their current rate.
+     * @param   output      The slider's new output, as getOutput() would report it. For a TouchSlider begun with a 
+     *                      curve, it's the curve's value at the new point.
+     */
+    struct tsl_event_t {
+        tsl_value_t value;
+        int32_t delta;
+        uint8_t pad;
+        uint32_t micros;
+        int32_t velocity;
+        uint16_t output;
+    };
+
+    /**
+     * @brief   The type a client-provided "slider event handler" function must have. It's the richer alternative 
+     *          to tsl_handler_t. Register it using setEventHandler().
+     * 
+     * @param   event       The details of the change. Only valid for the duration of the call.
+     * @param   client      The value the client passed when the event handler was registered.
+     */
+    using tsl_event_handler_t = void (*)(const tsl_event_t& event, void* client);
+
+    /**
+     * @brief   Set the eventHandler -- the function that will be called with a tsl_event_t when the value of the 
+     *          TouchSlider changes. It may be used together with, or instead of, the changeHandler.
+     * 
+     * @param handler   The function to call
+     * @param client    Client provided value. Whatever it is, it will be passed to the function when it's called.
+     */
+    void setEventHandler(tsl_event_handler_t handler, void* client);
+
+    /**
+     * @brief   The filters a subscriber can ask for. A filter decides which of the TouchSlider's value changes 
+     *          are passed on to the subscriber.
+     * 
+     *          TSL_EVERY_CHANGE    Every change, just like the changeHandler.
+     *          TSL_EVERY_NTH       Every Nth change, where N is the param passed to subscribe().
+     *          TSL_WHEN_IDLE       Only the most recent value, and only once the finger has been lifted from all 
+     *                              the sensors and any flick it started has ended.
+     */
+    enum tsl_filter_t : uint8_t {TSL_EVERY_CHANGE, TSL_EVERY_NTH, TSL_WHEN_IDLE};
+
+    /**
+     * @brief   Add a subscriber -- a function that, like the changeHandler, is called when the value of the 
+     *          TouchSlider changes, but only for the changes its filter lets through. Up to MAX_SUBSCRIBERS 
+     *          subscribers can be active at a time, in addition to the changeHandler. The subscriber table is 
+     *          statically allocated, so no heap is used.
+     * 
+     * @param handler   The function to call
+     * @param client    Client provided value. Whatever it is, it will be passed to the function when it's called.
+     * @param filter    Which changes the subscriber is interested in.
+     * @param param     For TSL_EVERY_NTH, N. N must be more than 0. Ignored otherwise.
+     * @return true     The subscriber was added
+     * @return false    The subscriber was not added; the table is full or the parameters are invalid
+     */
+    bool subscribe(tsl_handler_t handler, void* client, tsl_filter_t filter = TSL_EVERY_CHANGE, uint8_t param = 1);
+
+    /**
+     * @brief   Remove a subscriber previously added with subscribe().
+     * 
+     * @param handler   The handler that was passed to subscribe()
+     * @param client    The client value that was passed to subscribe()
+     * @return true     The subscriber was removed
+     * @return false    No such subscriber was found
+     */
+    bool unsubscribe(tsl_handler_t handler, void* client);
+
+    /**
+     * @brief   Bind the TouchSlider to a PWM output. Whenever the value changes, the TouchSlider does an 
+     *          analogWrite() of the (mapped) value to the pin itself, with no need for a change handler. Any 
+     *          previous binding is replaced.
+     * 
+     * @param pin       The PWM-capable GPIO pin to write to.
+     */
+    void bindPwm(uint8_t pin);
+
+    /**
+     * @brief   Bind the TouchSlider to an 8- or 16-bit register (or variable). Whenever the value changes, the 
+     *          TouchSlider stores the (mapped) value there itself, with no need for a change handler. Any previous 
+     *          binding is replaced.
+     * 
+     * @param reg       Pointer to the register to write to.
+     */
+    void bindRegister(volatile uint8_t* reg);
+    void bindRegister(volatile uint16_t* reg);
+
+    /**
+     * @brief   Remove the output binding, if any.
+     * 
+     */
+    void unbind();
+
+    /**
+     * @brief   Map the TouchSlider's value linearly onto outMin..outMax before writing it to the bound output: 
+     *          minValue goes to outMin and maxValue to outMax. The scale factor is computed once, in begin(), not on 
+     *          every change. Without a map, the value is written as-is.
+     * 
+     * @param outMin    The output for minValue
+     * @param outMax    The output for maxValue. May be less than outMin for a reversed output.
+     */
+    void setOutputRange(uint16_t outMin, uint16_t outMax);
+
+    /**
+     * @brief   Map the TouchSlider's value onto the output using a lookup table: minValue goes to table[0] and 
+     *          maxValue to table[len - 1], with values in between spread evenly over the table. The table isn't 
+     *          copied, so it must stay around as long as it's in use.
+     * 
+     * @param table     The table of outputs
+     * @param len       The number of entries in table. len >= 2
+     * @param progmem   True (the default) if table is in PROGMEM, false if it's in RAM.
+     * @return true     The table was accepted
+     * @return false    The table was not accepted; len is too small
+     */
+    bool setOutputTable(const uint16_t table[], uint16_t len, bool progmem = true);
+
+    /**
+     * @brief   Get the current output of the TouchSlider -- its value mapped as set up by setOutputRange(), 
+     *          setOutputTable() or begin() with a curve. Without a map, it's the value truncated to 16 bits.
+     * 
+     * @return uint16_t The current output
+     */
+    uint16_t getOutput();
+
+    /**
+     * @brief   Get the net change in the TouchSlider's value since the last call, encoder style, and start 
+     *          accumulating again from zero. It's independent of the handlers, which needn't be set, and cheap 
+     *          enough to call on every pass through loop().
+     * 
+     * @return int32_t  The net change since the last call
+     */
+    int32_t takeDelta();
+
+    /**
+     * @brief   Choose what takeDelta() accumulates. Normally it's the actual changes in the value, so nothing 
+     *          accumulates while the value is pinned at minValue or maxValue. In unclamped mode, it's every step 
+     *          the finger makes, whether or not the value could change -- just like a quadrature encoder.
+     * 
+     * @param unclamped True for unclamped mode, false (the default) for normal mode
+     */
+    void setDeltaUnclamped(bool unclamped);
+
+    /**
+     * @brief   Turn clamping of the value to minValue..maxValue on (the default) or off. With it off, the value 
+     *          is limited only by the range of tsl_value_t -- handy for a wheel used as an unbounded jog dial. 
+     *          Output maps still go from minValue to maxValue; outside that range, the output stays at its ends. 
+     *          Flicks and auto-repeat run on past minValue and maxValue too.
+     * 
+     * @param clamped   True to clamp, false not to
+     */
+    void setClamped(bool clamped);
+
+    /**
+     * @brief   Get the position of the finger on a circular TouchSlider (a wheel), in half-sensor units: 2 * s when 
+     *          the finger is on sensor s alone and 2 * s + 1 when it's on sensors s and s + 1 (or, for 
+     *          2 * pCount - 1, on the last and first sensors). When no finger is on the wheel, it's where the 
+     *          finger was lifted.
+     * 
+     * @return uint8_t  The position, 0 .. 2 * pCount - 1
+     */
+    uint8_t getWheelPosition();
+
+    /**
+     * @brief   Get the angle of the finger on a wheel, as for getWheelPosition(), but in 65536ths of a revolution 
+     *          with the first sensor at 0.
+     * 
+     * @return uint16_t The angle; 0 if the TouchSlider's construction failed
+     */
+    uint16_t getWheelAngle();
+
+    /**
+     * @brief   Get the number of complete revolutions the finger has made around a wheel since begin(): one more 
+     *          each time a slide goes from the last sensor to the first, one less each time one goes the other way.
+     * 
+     * @return int32_t  The net number of revolutions
+     */
+    int32_t getRevolutions();
+
+    /**
+     * @brief   Get an estimate of how fast the finger is going around a wheel, based on the time between the 
+     *          latest steps, in 65536ths of a revolution per second. Positive when going up. It falls off toward 0 
+     *          once the finger stops stepping.
+     * 
+     * @return int32_t  The angular velocity; 0 if the TouchSlider's construction failed
+     */
+    int32_t getWheelVelocity();
+
     /**
      * @brief Get the current value of the the TouchSlider
      * 
-     * @return int32_t  The current value of the TouchSlider
+     * @return tsl_value_t  The current value of the TouchSlider
      */
-    int32_t getValue();
+    tsl_value_t getValue();
 
     #ifdef TSL_DEBUG
     /**
@@ -213,23 +998,231 @@ public:
     #endif
     
 private:
+    friend class TouchSliderGroup;                          // Which dispatches to onTouched() and onReleased() itself
+    friend class TouchPad2D;                                // As does this
+
+    enum step_source_t : uint8_t {STEP_SLIDE, STEP_REPEAT, STEP_FLICK};
+                                                            // What made the value change: a finger sliding, 
+                                                            //   auto-repeat or a flick
+
+    bool enterService(tsl_value_t minV, tsl_value_t maxV, tsl_value_t curV, tsl_value_t inc);
+                                                            // The part of begin() after the checks
+    bool startSensors();                                    // begin() the TouchSensors and register our callbacks
+    void leaveService();                                    // Take us off the list of TouchSliders in service
+    uint8_t sensorIndex(uint8_t pin);                       // The index of the sensor on pin; nSensors if none
     static void touchedThunk(uint8_t pin, void* client);    // What we register with TouchSensor as "touched" a callback
-    void onTouched(uint8_t pin);                            // The actual callback
+    void onTouched(uint8_t sensorS);                        // The actual callback, given the sensor's index
     static void releasedThunk(uint8_t pin, void* client);   // What we regoister with TouchSensor as a "released" callback
-    void onReleased(uint8_t pin);                           // The actual callback
+    void onReleased(uint8_t sensorS);                       // The actual callback, given the sensor's index
+    void stepValue(tsl_wide_t steps, uint8_t pad, step_source_t src);
+                                                            // Change value by steps increments
+    void changeValue(tsl_wide_t inc, uint8_t pad, step_source_t src);
+                                                            // Change value by inc and tell everyone who cares
+    void onIdle();                                          // Handle the finger being lifted from all the sensors
+    void notifyIdle();                                      // Pass a pending change to the TSL_WHEN_IDLE subscribers
+    void noteStep(int8_t dir);                              // Keep track of the speed and direction of slide steps
+    void tick();                                            // Do the time-driven work; called from run()
+    void tickFlick();                                       // Do the flick part of tick()
+    void tickGesture();                                     // Do the gesture recognition part of tick()
+    void tickRepeat();                                      // Do the auto-repeat part of tick()
+    void seekDetent();                                      // Bring detentIx up to date with value
+    int32_t eventVelocity(int32_t delta, step_source_t src);
+                                                            // The velocity for the tsl_event_t of a change
+    bool atLimit(int32_t dir);                              // True if value can't go any further in direction dir
+    bool restoreValue(int32_t& v);                          // Get the newest persisted value from EEPROM, if any
+    void tickPersist();                                     // Do the persistence part of tick()
+    void tickDrift();                                       // Do the drift recovery part of tick()
+    void resetDrift();                                      // Start drift tracking afresh, with no sweep going
+    void recalibrate(uint8_t sensorS);                      // Restart a sensor, forgetting any touch it had
+    void noteTelemetry(uint32_t now);                       // Note a change to be reported by telemetry
+    void tickTelemetry();                                   // Do the telemetry part of tick()
+    bool contactOk();                                       // Check the contact; false if slides are suppressed
+    bool acceptStep(int8_t dir);                            // Apply reversal hysteresis; false if step is suppressed
+    void gestureTouched(uint8_t sensorS);                   // Gesture recognition for a touch
+    void gestureReleased();                                 // Gesture recognition for the finger being lifted
+    void noteEarlierTap();                                  // Report the tap before a touch that turns out not to 
+                                                            //   be the second of a double-tap
+    void prepareOutput();                                   // Precompute the output map and write the output
+    void writeOutput();                                     // Write the (mapped) value to the bound output
+    uint16_t mapValue();                                    // The value mapped for output
+
+    struct subscriber_t {                                   // An entry in the subscriber table
+        tsl_handler_t handler;                              //   The subscriber's handler; nullptr if slot is free
+        void* client;                                       //   The client-provided pointer passed to handler
+        tsl_filter_t filter;                                //   The subscriber's filter
+        uint8_t param;                                      //   The filter's parameter
+        uint8_t count;                                      //   Changes seen since last call (TSL_EVERY_NTH)
+                                                            //   or 1 if a change is pending (TSL_WHEN_IDLE)
+    };
 
     tsl_handler_t changeHandler = nullptr;                  // The client-provided value-change handler, if any
     void* clientData;                                       // The client-provided pointer passed to changeHandler
-    int32_t minValue;                                       // The minimum value the TouchSlide can take on
-    int32_t maxValue;                                       // The maximum value the TouchSLider can take on
-    int32_t value;                                          // The current value of the TouchSlider
-    int32_t increment;                                      // The increment the TouchSlider can change by
+    tsl_event_handler_t eventHandler = nullptr;             // The client-provided event handler, if any
+    void* eventClientData;                                  // The client-provided pointer passed to eventHandler
+    uint32_t lastChangeMicros = 0;                          // micros() at the most recent value change
+    #if MAX_SUBSCRIBERS > 0
+    subscriber_t subscriber[MAX_SUBSCRIBERS] = {};          // The subscriber table
+    uint8_t nSubscribers = 0;                               // Number of slots in use at the front of subscriber[]
+    #endif
+    tsl_value_t minValue;                                   // The minimum value the TouchSlide can take on
+    tsl_value_t maxValue;                                   // The maximum value the TouchSLider can take on
+    tsl_value_t value;                                      // The current value of the TouchSlider
+    tsl_value_t increment;                                  // The increment the TouchSlider can change by
     alignas(TouchSensor) unsigned char sensorStg[MAX_SENSORS * sizeof(TouchSensor)];
                                                             // Storage to instantiate our TouchSensors
     TouchSensor* sensor = reinterpret_cast<TouchSensor *>(sensorStg);
                                                             // Reinterpreted as TouchSensors for convenience
     uint8_t nSensors;                                       // How many TouchSensors we have
     bool sensorTouched[MAX_SENSORS] = { false };            // The state of the sensors (touched or not) at last run()
+    tsl_mask_t touchedMask = 0;                             // Bit s is set while sensor s is being touched
     uint8_t sensorPin[MAX_SENSORS];                         // The pin number for each of the sensors
+    uint8_t nTouched = 0;                                   // How many of the sensors are currently being touched
     bool inService = false;                                 // True if the TpuchSlider is in service, false otherwise
-};
\ No newline at end of file
+    static TouchSlider* firstInService;                     // The list of TouchSliders that are in service
+    static tsl_clock_t clockMillis;                         // Where all TouchSliders get the time in millis
+    static tsl_clock_t clockMicros;                         // Where all TouchSliders get the time in micros
+    static uint32_t arduinoMillis();                        // The default clockMillis: millis()
+    static uint32_t arduinoMicros();                        // The default clockMicros: micros()
+    TouchSlider* nextInService = nullptr;                   // The next TouchSlider in that list
+    TouchSliderGroup* group = nullptr;                      // The TouchSliderGroup we're a member of, if any
+    uint8_t groupId;                                        // Our id in group
+
+    int8_t stepDir = 0;                                     // Direction of the current run of slide steps (+1 or -1)
+    bool reversing = false;                                 // True if the last step was opposite to stepDir
+    uint32_t lastStepMicros = 0;                            // micros() at the last step in the current run
+    uint32_t reverseMicros = 0;                             // micros() at the step that was opposite to stepDir
+    uint32_t stepInterval = 0;                              // micros() between the last two steps of the run; 0 if
+                                                            //   unknown
+    uint16_t flickMinSpeed = 0;                             // Slide speed (steps/s) that starts a flick; 0 = disabled
+    uint8_t flickDecay;                                     // Flick speed multiplier per FLICK_PERIOD_MS, in 1/256ths
+    int32_t flickVelocity = 0;                              // Flick speed in 1/256 steps per FLICK_PERIOD_MS; 0 = none
+    int32_t flickAccum;                                     // Fractional flick steps accumulated, in 1/256ths
+    uint32_t flickMillis;                                   // millis() at the last flick period
+
+    enum gesture_state_t : uint8_t {GESTURE_IDLE, GESTURE_DOWN, GESTURE_TAPPED, GESTURE_NONE};
+                                                            // IDLE: Nothing going on
+                                                            // DOWN: Touched, no slide yet; maybe a tap or hold
+                                                            // TAPPED: Tapped; maybe the first of a double-tap
+                                                            // NONE: Not a gesture (slide, hold or double-tap 
+                                                            //   already reported); wait for the finger to lift
+    tsl_gesture_stg_t* gesture = nullptr;                   // Gesture recognition state; nullptr if it's off
+    tsl_repeat_stg_t* repeat = nullptr;                     // Auto-repeat state; nullptr if it's off
+
+    const tsl_value_t* detent;                              // The client-provided detent table, ascending
+    uint8_t nDetents = 0;                                   // The number of entries in detent; 0 if none
+    uint8_t detentIx;                                       // The number of detents <= value
+    uint8_t detentHold;                                     // Steps it takes to move off a detent
+    uint8_t detentHeld;                                     // Steps absorbed so far at the current detent
+
+    tsl_persist_stg_t* persist = nullptr;                   // Persistence state; nullptr if not persisting
+
+    bool palmReject = false;                                // True if palm rejection is on
+    bool circular = false;                                  // True if the last sensor is next to the first
+    bool checkContact = false;                              // True if contactOk() needs to be called on each change
+    bool multiContact = false;                              // True if more than a single finger is touching
+    tsl_two_finger_handler_t twoFingerHandler = nullptr;    // The client-provided two-finger handler, if any
+    void* twoFingerClientData;                              // The client-provided pointer passed to twoFingerHandler
+    uint8_t spread = 0;                                     // The current two-finger spread; 0 if not two fingers
+
+    uint8_t revEdges = 0;                                   // Reverse steps it takes to reverse; < 2 if off
+    uint16_t revMs;                                         // Time it takes to reverse; 0 if edges alone decide
+    int8_t lockDir = 0;                                     // The direction steps are locked in; 0 if not locked
+    uint8_t revPending = 0;                                 // Net reverse steps suppressed so far
+    uint32_t revMillis;                                     // millis() when the pending reversal started
+
+    tsl_drift_stg_t* drift = nullptr;                       // Drift recovery state; nullptr if it's off
+    tsl_telemetry_stg_t* telemetry = nullptr;               // Telemetry state; nullptr if it's off
+    bool testAtBegin = false;                               // True if begin() runs selfTest()
+    tsl_pad_diag_t* testDiag = nullptr;                     // Where begin()'s selfTest() puts its findings, if anywhere
+
+    int32_t fracIncrement = 0;                              // Increment per step in Q16.16; 0 to use increment
+    int32_t fracAccum = 0;                                  // Fraction of a unit accumulated so far, in Q16.16
+
+    int32_t deltaAccum = 0;                                 // Net change accumulated for takeDelta()
+    bool deltaUnclamped = false;                            // True if deltaAccum includes changes lost to clamping
+
+    bool clamped = true;                                    // True if value is clamped to minValue..maxValue
+    uint8_t restPad = 0;                                    // The sensor the finger was last lifted from
+    int32_t revolutions = 0;                                // Net slides from the last sensor to the first
+
+    enum : uint8_t {SINK_NONE, SINK_PWM, SINK_REG8, SINK_REG16} sinkType = SINK_NONE;
+                                                            // The kind of output we're bound to, if any
+    union {                                                 // Where the output goes, depending on sinkType
+        uint8_t pin;                                        //   SINK_PWM: the pin
+        volatile uint8_t* reg8;                             //   SINK_REG8: the register
+        volatile uint16_t* reg16;                           //   SINK_REG16: the register
+    } sink;
+    enum : uint8_t {MAP_NONE, MAP_LINEAR, MAP_TABLE} mapType = MAP_NONE;
+                                                            // How the value is mapped to the output
+    bool mapProgmem;                                        // MAP_TABLE: true if mapTable is in PROGMEM
+    uint16_t mapOutMin;                                     // MAP_LINEAR: output for minValue
+    uint16_t mapOutMax;                                     // MAP_LINEAR: output for maxValue
+    const uint16_t* mapTable;                               // MAP_TABLE: the table
+    uint16_t mapSpan;                                       // MAP_TABLE: the number of entries in the table - 1
+                                                            //   MAP_LINEAR: |mapOutMax - mapOutMin|
+    uint8_t mapPreShift;                                    // Right shift that brings value - minValue to 16 bits
+    uint8_t mapShift;                                       // The number of fraction bits in mapScale
+    uint32_t mapScale;                                      // mapSpan / ((maxValue - minValue) >> mapPreShift), 
+                                                            //   with mapShift fraction bits, rounded up; all 
+                                                            //   precomputed by prepareOutput()
+};
+// The storage the optional features keep their state in. Each is declared by the client -- only for the 
+// TouchSliders that use the feature -- and passed to the member function that turns the feature on.
+
+class TouchSlider::tsl_gesture_stg_t {
+    friend class TouchSlider;
+    tsl_gesture_handler_t handler;                          // The client-provided gesture handler
+    void* client;                                           // The client-provided pointer passed to handler
+    gesture_state_t state;                                  // Where recognition is; see gesture_state_t
+    uint8_t pad;                                            // The sensor the gesture is on
+    bool secondTap;                                         // DOWN: true if this touch followed a tap that hasn't 
+                                                            //   been reported yet
+    uint32_t startMillis;                                   // DOWN: millis() at touch; TAPPED: millis() at lift
+};
+
+class TouchSlider::tsl_repeat_stg_t {
+    friend class TouchSlider;
+    uint16_t delayMs;                                       // Hold time before auto-repeat starts
+    uint16_t startMs;                                       // First auto-repeat interval
+    uint16_t minMs;                                         // Shortest auto-repeat interval
+    uint16_t interval;                                      // Current auto-repeat interval
+    uint32_t lastMillis;                                    // millis() at arming or at the last repeat
+    int8_t dir;                                             // Auto-repeat direction (+1 or -1); 0 if not armed
+    uint8_t pad;                                            // The end sensor the finger is resting on
+    bool repeating;                                         // True once the first repeat has happened
+};
+
+class TouchSlider::tsl_persist_stg_t {
+    friend class TouchSlider;
+    uint16_t base;                                          // EEPROM address of the ring of value records
+    uint8_t slots;                                          // Number of records in the ring
+    uint16_t idleMs;                                        // Idle millis() before the value is saved
+    uint8_t slot;                                           // The slot the next record goes in
+    uint8_t seq;                                            // The sequence number of the next record
+    uint8_t next;                                           // Next byte of record to write; 
+                                                            //   PERSIST_RECORD_SIZE if not writing
+    uint8_t record[PERSIST_RECORD_SIZE];                    // The record being written: seq, value (LSB first), 
+                                                            //   check
+    bool dirty;                                             // True if value has changed since it was last saved
+};
+
+class TouchSlider::tsl_drift_stg_t {
+    friend class TouchSlider;
+    uint32_t stuckMs;                                       // Touched time before a sensor is stuck
+    uint32_t recalMs;                                       // Interval between routine recalibrations; 0 = none
+    uint32_t changeMillis;                                  // millis() when touchedMask last changed
+    uint32_t sweepMillis;                                   // millis() when the last routine recalibration ended
+    tsl_mask_t mask;                                        // touchedMask as of the last tickDrift()
+    uint8_t pad;                                            // Next sensor to recalibrate; TSL_NO_PAD if not sweeping
+};
+
+class TouchSlider::tsl_telemetry_stg_t {
+    friend class TouchSlider;
+    Print* port;                                            // Where telemetry goes
+    uint8_t id;                                             // The id in our telemetry frames
+    uint8_t seq;                                            // The sequence number of the next frame
+    uint8_t changes;                                        // Changes since the last frame was written
+    uint16_t period;                                        // Interval between unchanged frames; 0 if none
+    uint32_t changeMicros;                                  // micros() at the latest change not yet sent
+    uint32_t frameMillis;                                   // millis() when the last frame was written
+};
@@ -0,0 +1,154 @@
+/****
+ * This file is a part of the TouchSlider Arduino library for AVR architecture MPUs. See TouchSliderGroup.h for 
+ * details.
+ * 
+ *****
+ * 
+ * TouchSlider V1.0.2, November 2025
+ * Copyright (C) 2025 D.L. Ehnebuske
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ * 
+ ****/
+#include "TouchSliderGroup.h"
+
+// public member functions
+
+TouchSliderGroup::TouchSliderGroup() {
+    for (uint8_t p = 0; p < NUM_DIGITAL_PINS; p++) {
+        route[p].slider = TSG_NO_SLIDER;
+    }
+}
+
+TouchSliderGroup::~TouchSliderGroup() {
+    for (uint8_t sl = 0; sl < MAX_GROUP_SLIDERS; sl++) {
+        remove(sl);
+    }
+}
+
+uint8_t TouchSliderGroup::add(TouchSlider& s) {
+    if (!s.inService || (s.group != nullptr && s.group != this)) {
+        return TSG_NO_SLIDER;
+    }
+
+    // Find s's slot if it's already a member, or else a free one
+    uint8_t id = TSG_NO_SLIDER;
+    for (uint8_t sl = 0; sl < MAX_GROUP_SLIDERS; sl++) {
+        if (slider[sl] == &s) {
+            id = sl;
+            break;
+        }
+        if (slider[sl] == nullptr && id == TSG_NO_SLIDER) {
+            id = sl;
+        }
+    }
+    if (id == TSG_NO_SLIDER) {
+        return TSG_NO_SLIDER;
+    }
+
+    // Make sure none of its pins belongs to some other member
+    for (uint8_t sNo = 0; sNo < s.nSensors; sNo++) {
+        uint8_t r = route[s.sensorPin[sNo]].slider;
+        if (r != TSG_NO_SLIDER && r != id) {
+            return TSG_NO_SLIDER;
+        }
+    }
+
+    // Forget any stale routes (e.g., from before a reconfigure()) and route s's pins to it
+    for (uint8_t p = 0; p < NUM_DIGITAL_PINS; p++) {
+        if (route[p].slider == id) {
+            route[p].slider = TSG_NO_SLIDER;
+        }
+    }
+    slider[id] = &s;
+    s.group = this;
+    s.groupId = id;
+    for (uint8_t sNo = 0; sNo < s.nSensors; sNo++) {
+        route[s.sensorPin[sNo]] = {id, sNo};
+        s.sensor[sNo].setTouchedHandler(touchedThunk, this);
+        s.sensor[sNo].setReleasedHandler(releasedThunk, this);
+    }
+    return id;
+}
+
+bool TouchSliderGroup::remove(uint8_t sliderId) {
+    TouchSlider* s = getSlider(sliderId);
+    if (s == nullptr) {
+        return false;
+    }
+    for (uint8_t sNo = 0; sNo < s->nSensors; sNo++) {
+        route[s->sensorPin[sNo]].slider = TSG_NO_SLIDER;
+        s->sensor[sNo].setTouchedHandler(TouchSlider::touchedThunk, s);
+        s->sensor[sNo].setReleasedHandler(TouchSlider::releasedThunk, s);
+    }
+    s->group = nullptr;
+    slider[sliderId] = nullptr;
+    return true;
+}
+
+void TouchSliderGroup::setChangeHandler(tsg_handler_t handler, void* client) {
+    changeHandler = handler;
+    clientData = client;
+}
+
+TouchSlider* TouchSliderGroup::getSlider(uint8_t sliderId) {
+    return sliderId < MAX_GROUP_SLIDERS ? slider[sliderId] : nullptr;
+}
+
+void TouchSliderGroup::run() {
+    TouchSensor::run();
+    for (uint8_t sl = 0; sl < MAX_GROUP_SLIDERS; sl++) {
+        TouchSlider* s = slider[sl];
+        if (s == nullptr || !s->inService) {
+            continue;
+        }
+        tsl_value_t oldValue = s->value;
+        s->tick();
+        if (s->value != oldValue && changeHandler) {
+            changeHandler(sl, s->value, clientData);
+        }
+    }
+}
+
+// private member functions
+
+void TouchSliderGroup::touchedThunk(uint8_t pin, void* client) {
+    static_cast<TouchSliderGroup*>(client)->dispatch(pin, true);
+}
+
+void TouchSliderGroup::releasedThunk(uint8_t pin, void* client) {
+    static_cast<TouchSliderGroup*>(client)->dispatch(pin, false);
+}
+
+void TouchSliderGroup::dispatch(uint8_t pin, bool touched) {
+    route_t r = route[pin];
+    if (r.slider == TSG_NO_SLIDER) {
+        return;
+    }
+    TouchSlider* s = slider[r.slider];
+    tsl_value_t oldValue = s->value;
+    if (touched) {
+        s->onTouched(r.sensor);
+    } else {
+        s->onReleased(r.sensor);
+    }
+    if (s->value != oldValue && changeHandler) {
+        changeHandler(r.slider, s->value, clientData);
+    }
+}
@@ -0,0 +1,133 @@
+/****
+ * This file is a part of the TouchSlider Arduino library for AVR architecture MPUs. See TouchSlider.h for 
+ * details.
+ * 
+ * A TouchSliderGroup gathers several TouchSliders -- the faders on a mixing console, say -- so they can be 
+ * handled as one. The group takes over the touched and released callbacks of all its members' TouchSensors, 
+ * routing each one, by way of a table indexed by pin number, straight to the right TouchSlider and sensor. That 
+ * replaces the per-slider search for the sensor that changed. Value changes in any member are reported to a 
+ * single group change handler that's told which slider changed.
+ * 
+ * To use one, put each of the TouchSliders into service with its begin() and then add() it to the group. Call 
+ * the group's run() in loop() in place of TouchSensor::run() or TouchSlider::run(). If you call begin() on a 
+ * member again, add() it to the group again too.
+ * 
+ *****
+ * 
+ * TouchSlider V1.0.2, November 2025
+ * Copyright (C) 2025 D.L. Ehnebuske
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ * 
+ ****/
+#pragma once
+#ifndef Arduino_h
+    #include <Arduino.h>                                // Arduino goop
+#endif
+#include "TouchSlider.h"                                // TouchSlider goop
+
+constexpr uint8_t MAX_GROUP_SLIDERS = 8;                // The maximum number of TouchSliders in a TouchSliderGroup
+constexpr uint8_t TSG_NO_SLIDER = 0xFF;                 // "Not a slider id"
+
+class TouchSliderGroup {
+public:
+    /**
+     * @brief Construct a new, empty, TouchSliderGroup object
+     * 
+     */
+    TouchSliderGroup();
+
+    /**
+     * @brief   Destroy the TouchSliderGroup object, removing all its members first so their TouchSensors' callbacks 
+     *          go back to them.
+     * 
+     */
+    ~TouchSliderGroup();
+
+    /**
+     * @brief   Add a TouchSlider to the group. The TouchSlider must already be in service. Adding a TouchSlider 
+     *          that's already in the group just refreshes its routing (e.g., after its begin() was called again). 
+     *          A TouchSlider can be in only one group at a time. Destroying a member -- including releasing it 
+     *          back to a TouchSliderPool -- removes it from the group.
+     * 
+     * @param slider    The TouchSlider to add
+     * @return uint8_t  The slider's id within the group, or TSG_NO_SLIDER if it couldn't be added; the group is 
+     *                  full, the slider isn't in service, it's in another group or one of its pins already belongs 
+     *                  to another member.
+     */
+    uint8_t add(TouchSlider& slider);
+
+    /**
+     * @brief   Remove a TouchSlider from the group, giving its TouchSensors' callbacks back to it. The ids of the 
+     *          other members don't change.
+     * 
+     * @param sliderId  The id add() returned for the slider
+     * @return true     The slider was removed
+     * @return false    There's no slider with that id in the group
+     */
+    bool remove(uint8_t sliderId);
+
+    /**
+     * @brief   The type a client-provided "group change handler" function must have.
+     * 
+     * @param   sliderId    The id of the TouchSlider whose value changed
+     * @param   sliderValue The slider's new value.
+     * @param   client      The value the client passed when the change handler was registered.
+     */
+    using tsg_handler_t = void (*)(uint8_t sliderId, tsl_value_t sliderValue, void* client);
+
+    /**
+     * @brief Set the group's changeHandler -- the function that will be called when the value of any of its 
+     *        members changes. The members' own handlers, if any, are still called too.
+     * 
+     * @param handler   The function to call
+     * @param client    Client provided value. Whatever it is, it will be passed to the function when it's called.
+     */
+    void setChangeHandler(tsg_handler_t handler, void* client);
+
+    /**
+     * @brief   Get the member TouchSlider with the given id.
+     * 
+     * @param sliderId      The id add() returned for the slider
+     * @return TouchSlider* The TouchSlider, or nullptr if there's no slider with that id in the group
+     */
+    TouchSlider* getSlider(uint8_t sliderId);
+
+    /**
+     * @brief   Update the state of all the TouchSensors, in a single sweep, and then do the time-driven work of 
+     *          all the group's members. Call it a lot.
+     * 
+     */
+    void run();
+
+private:
+    static void touchedThunk(uint8_t pin, void* client);    // What we register with TouchSensor as "touched" callback
+    static void releasedThunk(uint8_t pin, void* client);   // What we register with TouchSensor as "released" callback
+    void dispatch(uint8_t pin, bool touched);               // Route a sensor state change to its TouchSlider
+
+    struct route_t {                                        // Where a pin's state changes go
+        uint8_t slider;                                     //   The id of the slider; TSG_NO_SLIDER if none
+        uint8_t sensor;                                     //   The index of the sensor within the slider
+    };
+
+    route_t route[NUM_DIGITAL_PINS];                        // The routing table, indexed by pin number
+    TouchSlider* slider[MAX_GROUP_SLIDERS] = {nullptr};     // The members, indexed by id; nullptr if slot is free
+    tsg_handler_t changeHandler = nullptr;                  // The client-provided group change handler, if any
+    void* clientData;                                       // The client-provided pointer passed to changeHandler
+};
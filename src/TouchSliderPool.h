@@ -0,0 +1,142 @@
+/****
+ * This file is a part of the TouchSlider Arduino library for AVR architecture MPUs. See TouchSlider.h for 
+ * details.
+ * 
+ * A TouchSliderPool is a compile-time-sized pool of TouchSliders for sketches that create and retire sliders as 
+ * they go -- as screens change, say -- but can't use the heap. The storage for the TouchSliders (and, since each 
+ * TouchSlider holds its own TouchSensors, for their TouchSensors too) is allocated statically, as part of the 
+ * pool, and TouchSliders are constructed in it and destroyed using "placement new" and explicit dtor calls, the 
+ * same way a TouchSlider manages its TouchSensors. So there's no fragmentation, and the SRAM used is fixed and 
+ * known at compile time.
+ * 
+ * Declare a pool, typically as a global, with the number of TouchSliders it holds as its template parameter, e.g.,
+ * 
+ *      TouchSliderPool<3> pool;
+ * 
+ * Then use acquire() in place of the TouchSlider ctor and release() in place of its dtor. highWater() tells how 
+ * many TouchSliders were ever in use at one time, which is handy for sizing the pool.
+ *****
+ * 
+ * TouchSlider V1.0.2, November 2025
+ * Copyright (C) 2025 D.L. Ehnebuske
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ * 
+ ****/
+#pragma once
+#ifndef Arduino_h
+    #include <Arduino.h>                                // Arduino goop
+#endif
+#include "TouchSlider.h"                                // TouchSlider goop
+#include <new>
+
+template <uint8_t N>
+class TouchSliderPool {
+public:
+    /**
+     * @brief   Destroy the TouchSliderPool. Any of its TouchSliders still in use are destroyed first, so none is
+     *          left in service, or in a TouchSliderGroup, once the pool's storage is gone.
+     */
+    ~TouchSliderPool() {
+        for (uint8_t ix = 0; ix < N; ix++) {
+            if (used[ix]) {
+                slider[ix].~TouchSlider();
+            }
+        }
+    }
+
+    /**
+     * @brief   Construct a TouchSlider in the pool. Equivalent to the TouchSlider ctor, but the TouchSlider lives in 
+     *          the pool's storage.
+     * 
+     * @param p             The array of GPIO pin numbers, as for the TouchSlider ctor.
+     * @param pCount        The number of pins in p. 2 <= pCount <= MAX_SENSORS
+     * @return TouchSlider* The new TouchSlider, or nullptr if the pool is full or pCount is out of range
+     */
+    TouchSlider* acquire(uint8_t p[], uint8_t pCount) {
+        if (pCount < 2 || pCount > MAX_SENSORS) {
+            return nullptr;
+        }
+        for (uint8_t ix = 0; ix < N; ix++) {
+            if (!used[ix]) {
+                used[ix] = true;
+                if (++nUsed > maxUsed) {
+                    maxUsed = nUsed;
+                }
+                return new (&slider[ix]) TouchSlider(p, pCount);    // Use "placement new" to instantiate it
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @brief   Destroy a TouchSlider obtained from acquire() and return its storage to the pool.
+     * 
+     * @param s         The TouchSlider
+     * @return true     The TouchSlider was destroyed
+     * @return false    The TouchSlider isn't one of this pool's TouchSliders that's in use
+     */
+    bool release(TouchSlider* s) {
+        for (uint8_t ix = 0; ix < N; ix++) {
+            if (s == &slider[ix] && used[ix]) {
+                slider[ix].~TouchSlider();
+                used[ix] = false;
+                nUsed--;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief   Get the number of TouchSliders currently in use.
+     * 
+     * @return uint8_t  The number in use
+     */
+    uint8_t inUse() {
+        return nUsed;
+    }
+
+    /**
+     * @brief   Get the most TouchSliders that have been in use at one time -- the high-water mark.
+     * 
+     * @return uint8_t  The high-water mark
+     */
+    uint8_t highWater() {
+        return maxUsed;
+    }
+
+    /**
+     * @brief   Get the number of TouchSliders the pool can hold.
+     * 
+     * @return uint8_t  The capacity of the pool
+     */
+    static constexpr uint8_t capacity() {
+        return N;
+    }
+
+private:
+    alignas(TouchSlider) unsigned char sliderStg[N * sizeof(TouchSlider)];
+                                                            // Storage to instantiate our TouchSliders
+    TouchSlider* slider = reinterpret_cast<TouchSlider *>(sliderStg);
+                                                            // Reinterpreted as TouchSliders for convenience
+    bool used[N] = { false };                               // Whether each slot is in use
+    uint8_t nUsed = 0;                                      // How many slots are in use
+    uint8_t maxUsed = 0;                                    // The most slots that have ever been in use at once
+};
@@ -0,0 +1,226 @@
+#!/usr/bin/env python3
+"""
+Decode and analyze TouchSlider telemetry (see TouchSlider::setTelemetry()).
+
+Reads the binary frame stream from a recorded file or, with pyserial installed, live from a serial port, and
+reports per-slider statistics: frames, checksum failures, frames lost (sequence gaps), changes combined into
+frames, the latency from a change to the frame reporting it, and the interval before each periodic (no change)
+frame, all in microseconds. The spread of the latency shows how promptly changes are reported; the spread of the
+periodic interval shows the jitter in the sketch's calls to run(). With matplotlib installed, --plot draws each
+slider's value and a timeline of each sensor's touched state; without it, --timeline prints the same information
+as text. Reading a serial port, frames are decoded as they arrive: --timeline prints each one as it comes in and
+--plot updates the plot a few times a second. The statistics are reported once reading ends.
+
+Examples:
+    tsl_telemetry.py capture.bin --timeline
+    tsl_telemetry.py /dev/ttyUSB0 --baud 115200 --seconds 30 --save capture.bin --plot
+    tsl_telemetry.py /dev/ttyUSB0 --seconds 0 --timeline      # until Ctrl-C
+
+This file is a part of the TouchSlider Arduino library. See TouchSlider.h for the copyright and license.
+"""
+import argparse
+import os
+import statistics
+import struct
+import sys
+import time
+
+SYNC = 0xA5                 # TSL_TELEMETRY_SYNC
+FRAME_SIZE = 22             # TSL_TELEMETRY_FRAME_SIZE
+FIELDS = struct.Struct("<BBBBBIIiIB")
+
+
+class Frame:
+    __slots__ = ("id", "sensors", "seq", "changes", "event_us", "sent_us", "value", "mask")
+
+    def __init__(self, raw):
+        (_, self.id, self.sensors, self.seq, self.changes, self.event_us, self.sent_us, self.value, self.mask,
+         _) = FIELDS.unpack(raw)
+
+
+class Decoder:
+    """Turns a byte stream, fed in pieces as it arrives, into frames."""
+
+    def __init__(self):
+        self.pending = bytearray()      # Bytes not yet decoded; the start of a frame still arriving, if any
+        self.bad = 0                    # Frames with a bad check byte
+
+    def feed(self, data):
+        """Return the valid frames completed by data, resynchronizing on the sync byte after any bad frame."""
+        buf = self.pending
+        buf += data
+        frames = []
+        i = 0
+        while i + FRAME_SIZE <= len(buf):
+            if buf[i] != SYNC:
+                i += 1
+                continue
+            raw = bytes(buf[i:i + FRAME_SIZE])
+            check = 0
+            for b in raw[1:-1]:
+                check ^= b
+            if check != raw[-1]:
+                self.bad += 1
+                i += 1
+                continue
+            frames.append(Frame(raw))
+            i += FRAME_SIZE
+        del buf[:i]
+        return frames
+
+
+def read_port(name, baud, seconds, consume):
+    """Pass what arrives on a serial port to consume() for seconds, or, if seconds is 0, until Ctrl-C."""
+    try:
+        import serial
+    except ImportError:
+        sys.exit("Reading from a serial port needs pyserial (pip install pyserial)")
+    with serial.Serial(name, baud, timeout=0.1) as port:
+        end = time.time() + seconds
+        try:
+            while seconds == 0 or time.time() < end:
+                data = port.read(4096)
+                if data:
+                    consume(data)
+        except KeyboardInterrupt:
+            pass
+
+
+def spread(samples):
+    if not samples:
+        return "n/a"
+    if len(samples) == 1:
+        return "mean %d" % samples[0]
+    return "mean %.0f  min %d  max %d  stdev %.1f" % (statistics.mean(samples), min(samples), max(samples),
+                                                    statistics.stdev(samples))
+
+
+def when(f):
+    """The time a frame describes: its latest change or, for a frame with no changes, when it was written."""
+    return f.event_us if f.changes else f.sent_us
+
+
+def add(sliders, f):
+    """Add a frame to its slider's frames and statistics, and return the slider."""
+    s = sliders.setdefault(f.id, {"frames": [], "lost": 0, "combined": 0, "latency": [], "period": []})
+    gap = 0
+    if s["frames"]:
+        gap = (f.seq - s["frames"][-1].seq - 1) & 0xFF
+        s["lost"] += gap
+    s["combined"] += max(f.changes - 1, 0)
+    if f.changes:
+        s["latency"].append((f.sent_us - f.event_us) & 0xFFFFFFFF)
+    elif s["frames"] and gap == 0:
+        # A periodic frame is sent once the period has passed since the frame before it, whatever that was
+        s["period"].append((f.sent_us - s["frames"][-1].sent_us) & 0xFFFFFFFF)
+    s["frames"].append(f)
+    return s
+
+
+def report(sliders, bad):
+    print("%d bad frame(s) skipped" % bad)
+    for sid, s in sorted(sliders.items()):
+        fs = s["frames"]
+        print("\nSlider %d: %d sensors, %d frames, %d lost, %d changes combined into other frames" %
+              (sid, fs[0].sensors, len(fs), s["lost"], s["combined"]))
+        print("  value      first %d  last %d  min %d  max %d" %
+              (fs[0].value, fs[-1].value, min(f.value for f in fs), max(f.value for f in fs)))
+        print("  change latency us  %s" % spread(s["latency"]))
+        print("  periodic interval us %s" % spread(s["period"]))
+
+
+def timeline(sid, s, f):
+    """Print a frame as a line of its slider's timeline."""
+    t0 = when(s["frames"][0])
+    pads = "".join("#" if f.mask >> p & 1 else "." for p in range(f.sensors))
+    print("slider %d %10.1f ms  %s  %d" % (sid, ((when(f) - t0) & 0xFFFFFFFF) / 1000.0, pads, f.value))
+
+
+def pyplot():
+    try:
+        import matplotlib.pyplot as plt
+    except ImportError:
+        sys.exit("--plot needs matplotlib (pip install matplotlib); try --timeline instead")
+    return plt
+
+
+def draw(fig, sliders):
+    """Draw each slider's value and touched sensors on fig, replacing whatever was there."""
+    fig.clf()
+    axes = fig.subplots(2 * len(sliders), 1, sharex=True, squeeze=False)
+    for row, (sid, s) in enumerate(sorted(sliders.items())):
+        fs = s["frames"]
+        t0 = when(fs[0])
+        t = [((when(f) - t0) & 0xFFFFFFFF) / 1000.0 for f in fs]
+        ax = axes[2 * row][0]
+        ax.step(t, [f.value for f in fs], where="post")
+        ax.set_ylabel("slider %d value" % sid)
+        ax = axes[2 * row + 1][0]
+        for p in range(fs[0].sensors):
+            ax.step(t, [p + 0.8 * (f.mask >> p & 1) for f in fs], where="post")
+        ax.set_ylabel("sensor touched")
+        ax.set_yticks(range(fs[0].sensors))
+    axes[-1][0].set_xlabel("ms")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode and analyze TouchSlider telemetry.")
+    parser.add_argument("source", help="a recorded telemetry file or a serial port")
+    parser.add_argument("--baud", type=int, default=115200, help="serial port speed (default 115200)")
+    parser.add_argument("--seconds", type=float, default=10.0,
+                        help="how long to read a serial port; 0 for until Ctrl-C (default 10)")
+    parser.add_argument("--save", metavar="FILE", help="also save the raw stream read from a serial port")
+    parser.add_argument("--timeline", action="store_true", help="print each frame as a text timeline")
+    parser.add_argument("--plot", action="store_true", help="plot values and touched sensors (needs matplotlib)")
+    args = parser.parse_args()
+
+    # Anything that isn't a regular file -- /dev/ttyUSB0, COM3 -- is a serial port. Opening a tty as a file would
+    # read forever.
+    live = not os.path.isfile(args.source)
+    if args.save and not live:
+        parser.error("--save only applies when reading a serial port")
+    plt = pyplot() if args.plot else None
+    fig = None
+    if plt:
+        if live:
+            plt.ion()
+        fig = plt.figure()
+    decoder = Decoder()
+    sliders = {}
+    save = open(args.save, "wb") if args.save else None
+    drawn = [0.0]                       # time.time() when the plot was last drawn
+
+    def consume(data):
+        if save:
+            save.write(data)
+        for f in decoder.feed(data):
+            s = add(sliders, f)
+            if args.timeline:
+                timeline(f.id, s, f)
+        if live and fig and sliders and time.time() - drawn[0] >= 0.25:
+            draw(fig, sliders)
+            plt.pause(0.001)
+            drawn[0] = time.time()
+
+    try:
+        if live:
+            read_port(args.source, args.baud, args.seconds, consume)
+        else:
+            with open(args.source, "rb") as f:
+                consume(f.read())
+    finally:
+        if save:
+            save.close()
+
+    if not sliders:
+        sys.exit("No telemetry frames found")
+    report(sliders, decoder.bad)
+    if fig:
+        draw(fig, sliders)
+        if live:
+            plt.ioff()
+        plt.show()
+
+
+if __name__ == "__main__":
+    main()